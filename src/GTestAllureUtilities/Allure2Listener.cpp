@@ -1,28 +1,25 @@
 #include "Allure2Listener.h"
 
 #include "AllureAPI.h"
-#include "Model/TestProperty.h"
+#include "Services/Report/Allure2TestResultJSONSerializer.h"
+#include "Services/Report/Allure2TestResultWriter.h"
+#include "Services/System/ITimeService.h"
+#include "Services/System/UUIDGenerator.h"
 
 #include <chrono>
 #include <cstdint>
-#include <filesystem>
-#include <fstream>
+#include <exception>
+#include <iostream>
 #include <limits>
-#include <random>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <thread>
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
 #if defined(__unix__) || defined(__APPLE__)
 #include <unistd.h>
 #endif
 
-namespace fs = std::filesystem;
-
 namespace systelab::gtest_allure {
 
 static thread_local std::string tl_uuid;
@@ -53,7 +50,7 @@ static std::string toHex(uint64_t value)
     return os.str();
 }
 
-static std::string getHostName()
+static std::string queryHostName()
 {
 #if defined(__unix__) || defined(__APPLE__)
     char buffer[256] = {};
@@ -77,53 +74,72 @@ static std::string getThreadLabel(const std::string& host)
     return os.str();
 }
 
-static void addLabel(rapidjson::Value& labels, rapidjson::Document::AllocatorType& alloc,
-                     const std::string& name, const std::string& value)
+// Host is resolved once per process and the thread label once per thread, so
+// no syscall nor stream formatting happens when each test ends
+static const std::shared_ptr<const std::vector<AllureAPI::Label>>& getEnvironmentLabels()
 {
-    rapidjson::Value l(rapidjson::kObjectType);
-    l.AddMember("name", rapidjson::Value(name.c_str(), alloc), alloc);
-    l.AddMember("value", rapidjson::Value(value.c_str(), alloc), alloc);
-    labels.PushBack(l, alloc);
+    static const std::string host = queryHostName();
+    static thread_local const std::shared_ptr<const std::vector<AllureAPI::Label>> environmentLabels =
+        std::make_shared<const std::vector<AllureAPI::Label>>(
+            service::Allure2TestResultJSONSerializer::buildEnvironmentLabels(host, getThreadLabel(host)));
+    return environmentLabels;
 }
 
 Allure2Listener::Allure2Listener()
+    : m_resultWriter(std::make_unique<service::Allure2TestResultWriter>(
+          std::make_unique<service::Allure2TestResultJSONSerializer>()))
+    , m_outputFolderVersion(std::numeric_limits<unsigned long long>::max())
 {
     AllureAPI::setGenerateLegacyResults(false);
 }
 
+Allure2Listener::~Allure2Listener() = default;
+
 long long Allure2Listener::nowMs()
 {
-    using namespace std::chrono;
-    return static_cast<long long>(
-        duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count()
-    );
+    return AllureAPI::getTimeService().getCurrentTimeMs();
 }
 
-std::string Allure2Listener::generateUuidV4()
+std::string Allure2Listener::generateUuid(model::UUIDVersion version)
 {
-    static thread_local std::mt19937_64 rng{std::random_device{}()};
-    std::uniform_int_distribution<uint64_t> dist(0, (std::numeric_limits<uint64_t>::max)());
+    return service::UUIDGenerator::generate(version);
+}
 
-    uint64_t a = dist(rng);
-    uint64_t b = dist(rng);
+void Allure2Listener::updateOutputFolder()
+{
+    // Only resolved again when the configuration changed (the writer itself
+    // only reopens the folder when its path changed)
+    const auto configuration = AllureAPI::getConfiguration();
+    if (m_outputFolderVersion.load() == configuration->version)
+        return;
+
+    std::string outputFolder = configuration->outputFolder;
+    if (outputFolder.empty())
+        outputFolder = "allure-results";
+    m_resultWriter->setOutputFolder(outputFolder);
+    m_outputFolderVersion.store(configuration->version);
+}
 
-    // RFC-4122 v4 + variant
-    a = (a & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL; // version 4
-    b = (b & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL; // variant 10xx
+void Allure2Listener::OnTestProgramStart(const ::testing::UnitTest&)
+{
+    updateOutputFolder();
 
-    std::ostringstream os;
-    os << std::hex
-       << ((a >> 32) & 0xFFFFFFFFULL) << "-"
-       << ((a >> 16) & 0xFFFFULL)     << "-"
-       << (a & 0xFFFFULL)             << "-"
-       << ((b >> 48) & 0xFFFFULL)     << "-"
-       << (b & 0xFFFFFFFFFFFFULL);
-    return os.str();
+    const auto configuration = AllureAPI::getConfiguration();
+    if (configuration->asyncResultsWriting)
+    {
+        m_resultWriter->start(configuration->asyncResultsQueueCapacity,
+                              configuration->asyncResultsBackPressurePolicy);
+    }
+}
+
+void Allure2Listener::OnTestSuiteStart(const ::testing::TestSuite&)
+{
+    AllureAPI::beginTestSuite();
 }
 
 void Allure2Listener::OnTestStart(const ::testing::TestInfo& testInfo)
 {
-    tl_uuid = generateUuidV4();
+    tl_uuid = generateUuid(AllureAPI::getResultsUUIDVersion());
     tl_startMs = static_cast<int64_t>(nowMs());
     AllureAPI::beginTestCase(testInfo.test_suite_name(), testInfo.name(), tl_uuid);
 }
@@ -136,187 +152,72 @@ void Allure2Listener::OnTestEnd(const ::testing::TestInfo& testInfo)
 
     const auto& r = *testInfo.result();
 
-    std::string outputDir = AllureAPI::getOutputFolder();
-    if (outputDir.empty())
-        outputDir = "allure-results";
-    fs::create_directories(outputDir);
+    // Follows AllureAPI::setOutputFolder calls made along the program
+    updateOutputFolder();
 
-    rapidjson::Document doc(rapidjson::kObjectType);
-    auto& alloc = doc.GetAllocator();
-
-    doc.AddMember("uuid", rapidjson::Value(tl_uuid.c_str(), alloc), alloc);
+    service::Allure2TestResult result;
+    result.uuid = tl_uuid;
 
     const std::string suite =
         AllureAPI::getCurrentTestSuiteName().empty()
             ? testInfo.test_suite_name()
             : AllureAPI::getCurrentTestSuiteName();
-    const std::string name =
+    result.name =
         AllureAPI::getCurrentTestCaseName().empty()
             ? testInfo.name()
             : AllureAPI::getCurrentTestCaseName();
-    const std::string fullName = suite + "." + name;
-    const std::string historyId = toHex(fnv1a64(fullName));
-
-    doc.AddMember("historyId", rapidjson::Value(historyId.c_str(), alloc), alloc);
-    doc.AddMember("name", rapidjson::Value(name.c_str(), alloc), alloc);
-    doc.AddMember("testCaseName", rapidjson::Value(name.c_str(), alloc), alloc);
-    doc.AddMember("fullName", rapidjson::Value(fullName.c_str(), alloc), alloc);
+    result.fullName = suite + "." + result.name;
+    result.historyId = toHex(fnv1a64(result.fullName));
+    result.status = statusFromGTest(r);
+    result.suiteName = suite;
+    result.configuration = AllureAPI::getConfiguration();
+    result.environmentLabels = getEnvironmentLabels();
 
-    doc.AddMember("status", rapidjson::Value(statusFromGTest(r), alloc), alloc);
-    doc.AddMember("stage", rapidjson::Value("finished", alloc), alloc);
+    result.data = AllureAPI::releaseTestCaseData();
+    result.start = tl_startMs;
+    result.stop = stopMs;
 
-    const auto& suiteLabels = AllureAPI::getTestSuiteLabels();
-    const auto& tags = AllureAPI::getTags();
-    const auto& caseLabels = AllureAPI::getLabels();
-    const auto description = AllureAPI::getDescription();
-    const auto host = getHostName();
-
-    const auto itSuiteName = suiteLabels.find(model::test_property::NAME_PROPERTY);
-    const std::string suiteLabelValue =
-        (itSuiteName != suiteLabels.end()) ? itSuiteName->second : suite;
-
-    doc.AddMember("description", rapidjson::Value(description.c_str(), alloc), alloc);
-
-    rapidjson::Value labels(rapidjson::kArrayType);
-    addLabel(labels, alloc, "suite", suiteLabelValue);
-
-    for (const auto& [nameKey, value] : suiteLabels)
-    {
-        if (nameKey == model::test_property::NAME_PROPERTY)
-            continue;
-
-        addLabel(labels, alloc, nameKey, value);
-    }
+    AllureAPI::endTestCase();
 
-    for (const auto& tag : tags)
-    {
-        addLabel(labels, alloc, "tag", tag);
-    }
+    m_resultWriter->write(std::move(result));
+}
 
-    for (const auto& label : caseLabels)
+template <typename Fn>
+static void flushCapturingError(Fn&& flush, std::exception_ptr& firstError)
+{
+    try
     {
-        if (!label.name.empty())
-            addLabel(labels, alloc, label.name, label.value);
+        flush();
     }
-
-    addLabel(labels, alloc, "host", host);
-    addLabel(labels, alloc, "thread", getThreadLabel(host));
-    addLabel(labels, alloc, "framework", "gtest");
-    addLabel(labels, alloc, "language", "cpp");
-
-    doc.AddMember("labels", labels, alloc);
-
-    const auto tmsId = AllureAPI::getTMSId();
+    catch (...)
     {
-        rapidjson::Value links(rapidjson::kArrayType);
-        if (!tmsId.empty())
-        {
-            rapidjson::Value l(rapidjson::kObjectType);
-            l.AddMember("type", rapidjson::Value("tms", alloc), alloc);
-            l.AddMember("name", rapidjson::Value(tmsId.c_str(), alloc), alloc);
-            const auto tmsLink = AllureAPI::formatTMSLink(tmsId);
-            if (!tmsLink.empty())
-                l.AddMember("url", rapidjson::Value(tmsLink.c_str(), alloc), alloc);
-            links.PushBack(l, alloc);
-        }
-        doc.AddMember("links", links, alloc);
+        if (!firstError)
+            firstError = std::current_exception();
     }
+}
 
-    const auto& steps = AllureAPI::getSteps();
+void Allure2Listener::OnTestProgramEnd(const ::testing::UnitTest&)
+{
+    // Both writers are drained even if one fails, and the first error is
+    // reported instead of escaping from the GoogleTest callback
+    std::exception_ptr firstError;
+    flushCapturingError([]() { AllureAPI::flushAttachments(); }, firstError);
+    flushCapturingError([this]() { m_resultWriter->flush(); }, firstError);
+    if (!firstError)
+        return;
+
+    try
     {
-        rapidjson::Value stepsArray(rapidjson::kArrayType);
-        for (const auto& step : steps)
-        {
-            rapidjson::Value s(rapidjson::kObjectType);
-            s.AddMember("name", rapidjson::Value(step.name.c_str(), alloc), alloc);
-            s.AddMember("status", rapidjson::Value(step.status.c_str(), alloc), alloc);
-            s.AddMember("stage", rapidjson::Value("finished", alloc), alloc);
-            s.AddMember("steps", rapidjson::Value(rapidjson::kArrayType), alloc);
-            s.AddMember("start", rapidjson::Value().SetInt64(step.startMs), alloc);
-            s.AddMember("stop",  rapidjson::Value().SetInt64(step.stopMs),  alloc);
-
-            if (!step.parameters.empty())
-            {
-                rapidjson::Value params(rapidjson::kArrayType);
-                for (const auto& param : step.parameters)
-                {
-                    rapidjson::Value p(rapidjson::kObjectType);
-                    p.AddMember("name", rapidjson::Value(param.name.c_str(), alloc), alloc);
-                    p.AddMember("value", rapidjson::Value(param.value.c_str(), alloc), alloc);
-                    params.PushBack(p, alloc);
-                }
-                s.AddMember("parameters", params, alloc);
-            }
-            else
-            {
-                s.AddMember("parameters", rapidjson::Value(rapidjson::kArrayType), alloc);
-            }
-
-            if (!step.attachments.empty())
-            {
-                rapidjson::Value attachments(rapidjson::kArrayType);
-                for (const auto& attachment : step.attachments)
-                {
-                    rapidjson::Value a(rapidjson::kObjectType);
-                    a.AddMember("name", rapidjson::Value(attachment.name.c_str(), alloc), alloc);
-                    a.AddMember("source", rapidjson::Value(attachment.source.c_str(), alloc), alloc);
-                    a.AddMember("type", rapidjson::Value(attachment.type.c_str(), alloc), alloc);
-                    attachments.PushBack(a, alloc);
-                }
-                s.AddMember("attachments", attachments, alloc);
-            }
-            else
-            {
-                s.AddMember("attachments", rapidjson::Value(rapidjson::kArrayType), alloc);
-            }
-
-            stepsArray.PushBack(s, alloc);
-        }
-        doc.AddMember("steps", stepsArray, alloc);
+        std::rethrow_exception(firstError);
     }
-
-    const auto& attachments = AllureAPI::getAttachments();
+    catch (const std::exception& error)
     {
-        rapidjson::Value attachmentsArray(rapidjson::kArrayType);
-        for (const auto& attachment : attachments)
-        {
-            rapidjson::Value a(rapidjson::kObjectType);
-            a.AddMember("name", rapidjson::Value(attachment.name.c_str(), alloc), alloc);
-            a.AddMember("source", rapidjson::Value(attachment.source.c_str(), alloc), alloc);
-            a.AddMember("type", rapidjson::Value(attachment.type.c_str(), alloc), alloc);
-            attachmentsArray.PushBack(a, alloc);
-        }
-        doc.AddMember("attachments", attachmentsArray, alloc);
+        std::cerr << "Allure results could not be fully saved: " << error.what() << std::endl;
     }
-
-    const auto& parameters = AllureAPI::getParameters();
+    catch (...)
     {
-        rapidjson::Value paramsArray(rapidjson::kArrayType);
-        for (const auto& param : parameters)
-        {
-            rapidjson::Value p(rapidjson::kObjectType);
-            p.AddMember("name", rapidjson::Value(param.name.c_str(), alloc), alloc);
-            p.AddMember("value", rapidjson::Value(param.value.c_str(), alloc), alloc);
-            paramsArray.PushBack(p, alloc);
-        }
-        doc.AddMember("parameters", paramsArray, alloc);
+        std::cerr << "Allure results could not be fully saved: unknown error" << std::endl;
     }
-
-    // Fix RapidJSON long long ambiguity:
-    doc.AddMember("start", rapidjson::Value().SetInt64(tl_startMs), alloc);
-    doc.AddMember("stop",  rapidjson::Value().SetInt64(stopMs),  alloc);
-
-    const fs::path outPath = fs::path(outputDir) / (tl_uuid + "-result.json");
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    doc.Accept(writer);
-
-    std::ofstream f(outPath, std::ios::binary);
-    f << buffer.GetString();
-    f.close();
-
-    AllureAPI::endTestCase();
 }
 
 } // namespace systelab::gtest_allure
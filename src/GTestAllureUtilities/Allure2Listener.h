@@ -1,23 +1,41 @@
 #pragma once
 
+#include "Model/UUIDVersion.h"
+
+#include <atomic>
 #include <gtest/gtest.h>
+#include <memory>
 #include <string>
 
 
 namespace systelab::gtest_allure {
 
+namespace service {
+class Allure2TestResultWriter;
+}
+
 class Allure2Listener final : public ::testing::EmptyTestEventListener
 {
 public:
     Allure2Listener();
-    ~Allure2Listener() override = default;
+    ~Allure2Listener() override;
 
+    void OnTestProgramStart(const ::testing::UnitTest& unitTest) override;
+    void OnTestSuiteStart(const ::testing::TestSuite& testSuite) override;
     void OnTestStart(const ::testing::TestInfo& testInfo) override;
     void OnTestEnd(const ::testing::TestInfo& testInfo) override;
+    void OnTestProgramEnd(const ::testing::UnitTest& unitTest) override;
 
 private:
-    static std::string generateUuidV4();
+    void updateOutputFolder();
+
+    static std::string generateUuid(model::UUIDVersion);
     static long long nowMs();
+
+private:
+    std::unique_ptr<service::Allure2TestResultWriter> m_resultWriter;
+    // Configuration snapshot the output folder was last resolved from
+    std::atomic<unsigned long long> m_outputFolderVersion;
 };
 
 } // namespace systelab::gtest_allure
@@ -6,22 +6,52 @@
 #include "Services/GoogleTest/IGTestStatusChecker.h"
 #include "Services/Property/ITestCasePropertySetter.h"
 #include "Services/Property/ITestSuitePropertySetter.h"
+#include "Services/Report/AttachmentWriter.h"
 #include "Services/ServicesFactory.h"
-
-#include <chrono>
+#include "Services/System/CoarseTimeService.h"
+#include "Services/System/ContentHasher.h"
+#include "Services/System/TimeService.h"
+#include "Services/System/UUIDGenerator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <mutex>
 
 namespace {
-std::mutex g_mutex;
-
-std::string g_outputFolder = "allure-results";
-std::string g_tmsId;
-std::string g_tmsPattern;
-std::string g_description;
-std::string g_epic;
-std::string g_severity;
-std::map<std::string, std::string> g_suiteLabels;
-bool g_generateLegacyResults = true;
+using Configuration = systelab::gtest_allure::AllureAPI::Configuration;
+
+// Serializes writers only: readers check the version counter, and atomically
+// load the published snapshot after a change
+std::mutex g_configurationMutex;
+std::atomic<std::shared_ptr<const Configuration>> g_configuration{
+    std::make_shared<const Configuration>()};
+std::atomic<unsigned long long> g_configurationVersion{0};
+
+// Snapshot last read by the calling thread: reading a setting only takes a
+// reference count when the configuration changed since then. References into
+// it are only used until the thread reads it again.
+thread_local std::shared_ptr<const Configuration> tl_configuration;
+
+template <typename Update> void updateConfiguration(Update update) {
+  std::lock_guard<std::mutex> lk(g_configurationMutex);
+  auto configuration = std::make_shared<Configuration>(
+      *g_configuration.load(std::memory_order_relaxed));
+  update(*configuration);
+  configuration->version++;
+  const unsigned long long version = configuration->version;
+  g_configuration.store(std::move(configuration), std::memory_order_release);
+  g_configurationVersion.store(version, std::memory_order_release);
+}
+
+const Configuration &getThreadConfiguration() {
+  if (!tl_configuration ||
+      (tl_configuration->version !=
+       g_configurationVersion.load(std::memory_order_acquire))) {
+    tl_configuration = g_configuration.load(std::memory_order_acquire);
+  }
+  return *tl_configuration;
+}
 
 // per-test (thread-local)
 thread_local std::string tl_suite;
@@ -32,12 +62,94 @@ thread_local std::vector<std::string> tl_tags;
 thread_local std::vector<systelab::gtest_allure::AllureAPI::Label> tl_labels;
 thread_local std::vector<systelab::gtest_allure::AllureAPI::Attachment> tl_attachments;
 thread_local std::vector<systelab::gtest_allure::AllureAPI::Parameter> tl_parameters;
-thread_local systelab::gtest_allure::AllureAPI::Step* tl_activeStep = nullptr;
+// Indexes in tl_steps of the steps currently running, innermost last
+thread_local std::vector<size_t> tl_stepStack;
+// Changed whenever tl_steps is cleared, so that step scopes still alive from
+// then on can tell their index no longer refers to their step
+thread_local unsigned long long tl_stepsGeneration = 0;
+
+// Reserved once per thread (stack) and per test case (steps), so that starting
+// a step does not allocate in the common case
+constexpr size_t STEP_STACK_CAPACITY = 16;
+constexpr size_t STEPS_CAPACITY = 32;
+
+systelab::gtest_allure::AllureAPI::Step *getActiveStep() {
+  return tl_stepStack.empty() ? nullptr : &tl_steps[tl_stepStack.back()];
+}
+
+const char *const PASSED_STEP_STATUS = "passed";
+const char *const FAILED_STEP_STATUS = "failed";
+const char *const BROKEN_STEP_STATUS = "broken";
+
+const systelab::gtest_allure::service::ITimeService &
+getClockTimeService(systelab::gtest_allure::model::ClockType clockType) {
+  static const systelab::gtest_allure::service::TimeService preciseTimeService;
+  static const systelab::gtest_allure::service::CoarseTimeService
+      coarseTimeService;
+  if (clockType == systelab::gtest_allure::model::ClockType::COARSE)
+    return coarseTimeService;
+
+  return preciseTimeService;
+}
+
+// Switched by setClockType; read on every step start/stop
+std::atomic<const systelab::gtest_allure::service::ITimeService *>
+    g_timeService{&getClockTimeService(
+        systelab::gtest_allure::model::ClockType::PRECISE)};
 
 static long long nowMs() {
-  using namespace std::chrono;
-  return duration_cast<milliseconds>(system_clock::now().time_since_epoch())
-      .count();
+  return g_timeService.load(std::memory_order_relaxed)->getCurrentTimeMs();
+}
+
+void addAttachmentToActiveStep(
+    systelab::gtest_allure::AllureAPI::Attachment attachment) {
+  if (auto *activeStep = getActiveStep()) {
+    activeStep->attachments.push_back(std::move(attachment));
+  } else {
+    tl_attachments.push_back(std::move(attachment));
+  }
+}
+
+std::string getAttachmentsOutputFolder(const std::string &outputFolder) {
+  return outputFolder.empty() ? "allure-results" : outputFolder;
+}
+
+// Shared by all test threads; its writer thread is started on the first write
+systelab::gtest_allure::service::AttachmentWriter &getAttachmentWriter() {
+  static systelab::gtest_allure::service::AttachmentWriter attachmentWriter;
+  static std::once_flag outputFolderSet;
+  std::call_once(outputFolderSet, []() {
+    attachmentWriter.setOutputFolder(
+        getAttachmentsOutputFolder(getThreadConfiguration().outputFolder));
+  });
+  return attachmentWriter;
+}
+
+// Content streamed into an AttachmentStream is handed to the writer in chunks
+// of this size
+constexpr size_t ATTACHMENT_STREAM_CHUNK_SIZE = 64 * 1024;
+
+const char *getAttachmentFileExtension(const std::string &type) {
+  static const std::pair<const char *, const char *> fileExtensions[] = {
+      {"text/plain", ".txt"},        {"text/html", ".html"},
+      {"text/csv", ".csv"},          {"text/xml", ".xml"},
+      {"application/xml", ".xml"},   {"application/json", ".json"},
+      {"image/png", ".png"},         {"image/jpeg", ".jpg"},
+      {"image/gif", ".gif"},         {"image/svg+xml", ".svg"},
+      {"video/mp4", ".mp4"},         {"application/zip", ".zip"}};
+
+  auto it = std::find_if(std::begin(fileExtensions), std::end(fileExtensions),
+                         [&type](const auto &fileExtension) {
+                           return type == fileExtension.first;
+                         });
+  return (it != std::end(fileExtensions)) ? it->second : "";
+}
+
+std::string buildAttachmentFileName(std::string fileName,
+                                    const std::string &type) {
+  fileName += "-attachment";
+  fileName += getAttachmentFileExtension(type);
+  return fileName;
 }
 } // namespace
 
@@ -48,6 +160,16 @@ model::TestProgram AllureAPI::m_testProgram = model::TestProgram();
 service::IServicesFactory *AllureAPI::m_servicesFactory =
     new service::ServicesFactory(m_testProgram);
 
+void AllureAPI::beginTestSuite() {
+  // Only takes the lock when the previous suite was given a name
+  if (getThreadConfiguration().suiteLabels.count(
+          model::test_property::NAME_PROPERTY) > 0) {
+    updateConfiguration([](Configuration &c) {
+      c.suiteLabels.erase(model::test_property::NAME_PROPERTY);
+    });
+  }
+}
+
 void AllureAPI::beginTestCase(const std::string &suiteName,
                               const std::string &gtestName,
                               const std::string &uuid) {
@@ -56,7 +178,8 @@ void AllureAPI::beginTestCase(const std::string &suiteName,
   tl_labels.clear();
   tl_attachments.clear();
   tl_parameters.clear();
-  tl_activeStep = nullptr;
+  tl_stepStack.clear();
+  tl_stepsGeneration++;
   tl_uuid = uuid;
 
   // suite can be overridden globally by setTestSuiteName if you have it;
@@ -77,6 +200,25 @@ void AllureAPI::endTestCase() {
   // Steps/tags are cleared at beginTestCase so Allure2Listener can read them.
 }
 
+AllureAPI::TestCaseData AllureAPI::releaseTestCaseData() {
+  TestCaseData data;
+  data.tags = std::move(tl_tags);
+  data.labels = std::move(tl_labels);
+  data.steps = std::move(tl_steps);
+  data.attachments = std::move(tl_attachments);
+  data.parameters = std::move(tl_parameters);
+
+  tl_tags.clear();
+  tl_labels.clear();
+  tl_steps.clear();
+  tl_attachments.clear();
+  tl_parameters.clear();
+  tl_stepStack.clear();
+  tl_stepsGeneration++;
+
+  return data;
+}
+
 std::unique_ptr<::testing::TestEventListener> AllureAPI::buildListener() {
   return getServicesFactory()->buildGTestEventListener();
 }
@@ -88,18 +230,16 @@ void AllureAPI::setTestProgramName(const std::string &name) {
 }
 
 void AllureAPI::setOutputFolder(const std::string &outputFolder) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_outputFolder = outputFolder;
-  }
+  updateConfiguration([&](Configuration &c) { c.outputFolder = outputFolder; });
   m_testProgram.setOutputFolder(outputFolder);
+  getAttachmentWriter().setOutputFolder(
+      getAttachmentsOutputFolder(outputFolder));
 }
 
 void AllureAPI::setTMSLinksPattern(const std::string &tmsLinkPattern) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_tmsPattern = tmsLinkPattern;
-  }
+  model::LinkTemplate tmsLinkTemplate(tmsLinkPattern);
+  updateConfiguration(
+      [&](Configuration &c) { c.tmsLinkTemplate = tmsLinkTemplate; });
   m_testProgram.setTMSLinksPattern(tmsLinkPattern);
 }
 
@@ -107,25 +247,93 @@ void AllureAPI::setFormat(model::Format format) {
   m_testProgram.setFormat(format);
 }
 
+void AllureAPI::setClockType(model::ClockType clockType) {
+  m_testProgram.setClockType(clockType);
+  g_timeService.store(&getClockTimeService(clockType));
+}
+
+model::ClockType AllureAPI::getClockType() {
+  return m_testProgram.getClockType();
+}
+
+void AllureAPI::setReportWorkersCount(unsigned int reportWorkersCount) {
+  m_testProgram.setReportWorkersCount(reportWorkersCount);
+}
+
+unsigned int AllureAPI::getReportWorkersCount() {
+  return m_testProgram.getReportWorkersCount();
+}
+
+void AllureAPI::setIncrementalReports(bool enable) {
+  m_testProgram.setIncrementalReports(enable);
+}
+
+bool AllureAPI::getIncrementalReports() {
+  return m_testProgram.getIncrementalReports();
+}
+
+void AllureAPI::setReportSerializer(model::ReportSerializer reportSerializer) {
+  m_testProgram.setReportSerializer(reportSerializer);
+}
+
+model::ReportSerializer AllureAPI::getReportSerializer() {
+  return m_testProgram.getReportSerializer();
+}
+
+const service::ITimeService &AllureAPI::getTimeService() {
+  return *g_timeService.load(std::memory_order_relaxed);
+}
+
 void AllureAPI::setGenerateLegacyResults(bool enable) {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  g_generateLegacyResults = enable;
+  updateConfiguration(
+      [&](Configuration &c) { c.generateLegacyResults = enable; });
 }
 
 bool AllureAPI::getGenerateLegacyResults() {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  return g_generateLegacyResults;
+  return getThreadConfiguration().generateLegacyResults;
+}
+
+void AllureAPI::setAsyncResultsWriting(bool enable) {
+  updateConfiguration(
+      [&](Configuration &c) { c.asyncResultsWriting = enable; });
+}
+
+bool AllureAPI::getAsyncResultsWriting() {
+  return getThreadConfiguration().asyncResultsWriting;
+}
+
+void AllureAPI::setAsyncResultsQueueCapacity(size_t capacity) {
+  updateConfiguration(
+      [&](Configuration &c) { c.asyncResultsQueueCapacity = capacity; });
+}
+
+size_t AllureAPI::getAsyncResultsQueueCapacity() {
+  return getThreadConfiguration().asyncResultsQueueCapacity;
+}
+
+void AllureAPI::setAsyncResultsBackPressurePolicy(
+    model::BackPressurePolicy policy) {
+  updateConfiguration(
+      [&](Configuration &c) { c.asyncResultsBackPressurePolicy = policy; });
+}
+
+model::BackPressurePolicy AllureAPI::getAsyncResultsBackPressurePolicy() {
+  return getThreadConfiguration().asyncResultsBackPressurePolicy;
+}
+
+void AllureAPI::setResultsUUIDVersion(model::UUIDVersion version) {
+  updateConfiguration(
+      [&](Configuration &c) { c.resultsUUIDVersion = version; });
+}
+
+model::UUIDVersion AllureAPI::getResultsUUIDVersion() {
+  return getThreadConfiguration().resultsUUIDVersion;
 }
 
 void AllureAPI::setTMSId(const std::string &value) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_tmsId = value;
-  }
-  auto testSuitePropertySetter =
-      getServicesFactory()->buildTestSuitePropertySetter();
-  testSuitePropertySetter->setProperty(model::test_property::TMS_ID_PROPERTY,
-                                       value);
+  updateConfiguration([&](Configuration &c) { c.tmsId = value; });
+  getServicesFactory()->getTestSuitePropertySetter().setProperty(
+      model::test_property::TMS_ID_PROPERTY, value);
 }
 
 void AllureAPI::setTestSuiteName(const std::string &name) {
@@ -134,56 +342,44 @@ void AllureAPI::setTestSuiteName(const std::string &name) {
 }
 
 void AllureAPI::setTestSuiteDescription(const std::string &description) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_description = description;
-  }
+  updateConfiguration([&](Configuration &c) { c.description = description; });
   setTestSuiteLabel(model::test_property::FEATURE_PROPERTY, description);
 }
 
 void AllureAPI::setTestSuiteEpic(const std::string &epic) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_epic = epic;
-  }
+  updateConfiguration([&](Configuration &c) { c.epic = epic; });
   setTestSuiteLabel(model::test_property::EPIC_PROPERTY, epic);
 }
 
 void AllureAPI::setTestSuiteSeverity(const std::string &severity) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_severity = severity;
-  }
+  updateConfiguration([&](Configuration &c) { c.severity = severity; });
   setTestSuiteLabel(model::test_property::SEVERITY_PROPERTY, severity);
 }
 
 void AllureAPI::setTestSuiteLabel(const std::string &name,
                                   const std::string &value) {
-  {
-    std::lock_guard<std::mutex> lk(g_mutex);
-    g_suiteLabels[name] = value;
-  }
-  auto testSuitePropertySetter =
-      getServicesFactory()->buildTestSuitePropertySetter();
-  testSuitePropertySetter->setProperty(name, value);
+  updateConfiguration([&](Configuration &c) { c.suiteLabels[name] = value; });
+  getServicesFactory()->getTestSuitePropertySetter().setProperty(name, value);
 }
 
 void AllureAPI::setTestCaseName(const std::string &name) {
   tl_case = name;
-  auto testCasePropertySetter =
-      getServicesFactory()->buildTestCasePropertySetter();
-  testCasePropertySetter->setProperty(model::test_property::NAME_PROPERTY,
-                                      name);
+  getServicesFactory()->getTestCasePropertySetter().setProperty(
+      model::test_property::NAME_PROPERTY, name);
 }
 
 void AllureAPI::addAction(const std::string &name,
                           std::function<void()> actionFunction) {
-  addStep(name, true, actionFunction);
+  StepScope step(name, model::StepType::ACTION_STEP);
+  actionFunction();
+  step.end();
 }
 
 void AllureAPI::addExpectedResult(const std::string &name,
                                   std::function<void()> verificationFunction) {
-  addStep(name, false, verificationFunction);
+  StepScope step(name, model::StepType::EXPECTED_RESULT_STEP);
+  verificationFunction();
+  step.end();
 }
 
 void AllureAPI::addTag(const std::string &tag) {
@@ -205,48 +401,112 @@ const std::vector<AllureAPI::Label> &AllureAPI::getLabels() {
   return tl_labels;
 }
 
-void AllureAPI::addStep(const std::string &name, bool isAction,
-                        std::function<void()> stepFunction) {
-  Step s;
-  s.name = name;
-  s.startMs = nowMs();
+AllureAPI::StepScope::StepScope(const std::string &name,
+                                model::StepType type)
+    : m_stepIndex(tl_steps.size()), m_stepsGeneration(tl_stepsGeneration),
+      m_uncaughtExceptions(std::uncaught_exceptions()), m_ended(false) {
+  long long startMs = nowMs();
 
-  auto stepStartEventHandler =
-      getServicesFactory()->buildTestStepStartEventHandler();
-  stepStartEventHandler->handleTestStepStart(name, isAction);
+  getServicesFactory()->getTestStepStartEventHandler().handleTestStepStart(
+      name, type == model::StepType::ACTION_STEP);
 
-  tl_activeStep = &s;
-  try {
-    stepFunction();
+  if (tl_steps.capacity() == 0) {
+    tl_steps.reserve(STEPS_CAPACITY);
+  }
+  if (tl_stepStack.capacity() == 0) {
+    tl_stepStack.reserve(STEP_STACK_CAPACITY);
+  }
+
+  // Steps are recorded in start order, so nested steps follow their parent
+  Step &step = tl_steps.emplace_back();
+  step.name = name;
+  step.startMs = startMs;
+  tl_stepStack.push_back(m_stepIndex);
+}
+
+AllureAPI::StepScope::~StepScope() noexcept {
+  // Exceptions inside steps -> "broken" in Allure terms. Errors reporting the
+  // step end are not rethrown here, as the step is already marked as broken.
+  if (!m_ended) {
+    finish(std::uncaught_exceptions() > m_uncaughtExceptions);
+  }
+}
+
+void AllureAPI::StepScope::end() {
+  if (m_ended) {
+    return;
+  }
+
+  std::exception_ptr stepEndError = finish(false);
+  if (stepEndError) {
+    std::rethrow_exception(stepEndError);
+  }
+}
+
+std::exception_ptr AllureAPI::StepScope::finish(bool broken) noexcept {
+  m_ended = true;
+
+  // Nothing is reported when the step was already finished along with an
+  // enclosing step, or when the test case data was released meanwhile
+  if ((m_stepsGeneration != tl_stepsGeneration) ||
+      (std::find(tl_stepStack.begin(), tl_stepStack.end(), m_stepIndex) ==
+       tl_stepStack.end())) {
+    return nullptr;
+  }
 
-    auto statusChecker = getServicesFactory()->buildGTestStatusChecker();
-    auto currentStatus = statusChecker->getCurrentTestStatus();
+  // Steps still running inside this one are finished first, as broken
+  std::exception_ptr nestedStepEndError;
+  while (tl_stepStack.back() != m_stepIndex) {
+    std::exception_ptr stepEndError = finishActiveStep(true);
+    if (!nestedStepEndError) {
+      nestedStepEndError = stepEndError;
+    }
+  }
 
-    // Best-effort mapping:
-    // If your IGTestStatusChecker returns something else, adjust here.
-    // We'll use "passed" unless the test is failing at this point.
-    s.status = (::testing::Test::HasFailure() ? "failed" : "passed");
+  std::exception_ptr stepEndError = finishActiveStep(broken);
+  return stepEndError ? stepEndError : nestedStepEndError;
+}
 
-    auto stepEndEventHandler =
-        getServicesFactory()->buildTestStepEndEventHandler();
-    stepEndEventHandler->handleTestStepEnd(currentStatus);
+std::exception_ptr AllureAPI::StepScope::finishActiveStep(bool broken) noexcept {
+  std::exception_ptr stepEndError;
+  try {
+    auto *servicesFactory = getServicesFactory();
+    auto currentStatus =
+        broken ? model::Status::BROKEN
+               : servicesFactory->getGTestStatusChecker().getCurrentTestStatus();
+    servicesFactory->getTestStepEndEventHandler().handleTestStepEnd(
+        currentStatus);
   } catch (...) {
-    // Exceptions inside steps -> "broken" in Allure terms
-    s.status = "broken";
-    s.stopMs = nowMs();
-    tl_activeStep = nullptr;
-    tl_steps.push_back(std::move(s));
-    throw;
+    stepEndError = std::current_exception();
+  }
+
+  const size_t stepIndex = tl_stepStack.back();
+  tl_stepStack.pop_back();
+
+  Step &step = tl_steps[stepIndex];
+  if (broken || stepEndError) {
+    step.status = BROKEN_STEP_STATUS;
+  } else {
+    step.status = ::testing::Test::HasFailure() ? FAILED_STEP_STATUS
+                                                : PASSED_STEP_STATUS;
   }
 
-  s.stopMs = nowMs();
-  tl_activeStep = nullptr;
-  tl_steps.push_back(std::move(s));
+  // Steps are finished innermost first, so every step recorded after this one
+  // was started (and finished) while it was running
+  step.stopMs = nowMs();
+  step.nestedStepsCount =
+      static_cast<unsigned int>(tl_steps.size() - stepIndex - 1);
+
+  return stepEndError;
+}
+
+std::shared_ptr<const AllureAPI::Configuration> AllureAPI::getConfiguration() {
+  getThreadConfiguration();
+  return tl_configuration;
 }
 
 std::string AllureAPI::getOutputFolder() {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  return g_outputFolder;
+  return getThreadConfiguration().outputFolder;
 }
 
 std::string AllureAPI::getCurrentTestSuiteName() { return tl_suite; }
@@ -254,50 +514,131 @@ std::string AllureAPI::getCurrentTestSuiteName() { return tl_suite; }
 std::string AllureAPI::getCurrentTestCaseName() { return tl_case; }
 
 std::string AllureAPI::getTMSId() {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  return g_tmsId;
+  return getThreadConfiguration().tmsId;
 }
 
 std::string AllureAPI::getTestSuiteEpic() {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  return g_epic;
+  return getThreadConfiguration().epic;
 }
 
 std::string AllureAPI::getTestSuiteSeverity() {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  return g_severity;
+  return getThreadConfiguration().severity;
 }
 
 std::string AllureAPI::getDescription() {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  return g_description;
+  return getThreadConfiguration().description;
 }
 
-const std::map<std::string, std::string> &AllureAPI::getTestSuiteLabels() {
-  return g_suiteLabels;
+std::map<std::string, std::string> AllureAPI::getTestSuiteLabels() {
+  return getThreadConfiguration().suiteLabels;
 }
 
 const std::vector<AllureAPI::Step> &AllureAPI::getSteps() { return tl_steps; }
 
 void AllureAPI::addAttachment(const std::string &name, const std::string &type,
                               const std::string &filePath) {
-  Attachment attachment{name, filePath, type};
-  if (tl_activeStep) {
-    tl_activeStep->attachments.push_back(std::move(attachment));
-  } else {
-    tl_attachments.push_back(std::move(attachment));
-  }
+  addAttachmentToActiveStep({name, filePath, type});
+}
+
+void AllureAPI::addAttachmentContent(const std::string &name,
+                                     const std::string &type,
+                                     std::string_view content) {
+  // Named after the hash of its content, so that attaching the same content
+  // again (e.g. a golden file on every test) reuses the file already saved
+  std::string fileName = buildAttachmentFileName(
+      service::ContentHasher::hashToHex(content), type);
+  addAttachmentToActiveStep({name, fileName, type});
+  getAttachmentWriter().saveOnce(fileName, content);
+}
+
+void AllureAPI::addAttachment(const std::string &name, const std::string &type,
+                              std::span<const std::byte> content) {
+  addAttachmentContent(
+      name, type,
+      std::string_view(reinterpret_cast<const char *>(content.data()),
+                       content.size()));
 }
 
 const std::vector<AllureAPI::Attachment> &AllureAPI::getAttachments() {
   return tl_attachments;
 }
 
+void AllureAPI::setAttachmentsPendingBytesCapacity(size_t capacity) {
+  getAttachmentWriter().setPendingBytesCapacity(capacity);
+}
+
+size_t AllureAPI::getAttachmentsPendingBytesCapacity() {
+  return getAttachmentWriter().getPendingBytesCapacity();
+}
+
+void AllureAPI::flushAttachments() { getAttachmentWriter().flush(); }
+
+AllureAPI::AttachmentStream::AttachmentStream(const std::string &name,
+                                              const std::string &type)
+    : m_fileName(buildAttachmentFileName(
+          service::UUIDGenerator::generate(getResultsUUIDVersion()), type)),
+      m_chunk(), m_chunkWritten(false) {
+  addAttachmentToActiveStep({name, m_fileName, type});
+  m_chunk.reserve(ATTACHMENT_STREAM_CHUNK_SIZE);
+}
+
+AllureAPI::AttachmentStream::~AttachmentStream() noexcept {
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+AllureAPI::AttachmentStream &
+AllureAPI::AttachmentStream::write(std::string_view content) {
+  // Large contents are split, so that no chunk exceeds the chunk size
+  while (!content.empty()) {
+    const size_t length = std::min(
+        content.size(), ATTACHMENT_STREAM_CHUNK_SIZE - m_chunk.size());
+    m_chunk.append(content.substr(0, length));
+    content.remove_prefix(length);
+
+    if (m_chunk.size() == ATTACHMENT_STREAM_CHUNK_SIZE) {
+      writeChunk();
+    }
+  }
+
+  return *this;
+}
+
+AllureAPI::AttachmentStream &
+AllureAPI::AttachmentStream::write(std::span<const std::byte> content) {
+  return write(std::string_view(reinterpret_cast<const char *>(content.data()),
+                                content.size()));
+}
+
+void AllureAPI::AttachmentStream::close() {
+  // The file is created even when nothing has been written
+  if (!m_chunk.empty() || !m_chunkWritten) {
+    writeChunk();
+  }
+
+  std::string().swap(m_chunk);
+}
+
+void AllureAPI::AttachmentStream::writeChunk() {
+  // The first chunk creates (or truncates) the file, next ones are appended
+  if (m_chunkWritten) {
+    getAttachmentWriter().append(m_fileName, std::move(m_chunk));
+  } else {
+    getAttachmentWriter().save(m_fileName, std::move(m_chunk));
+    m_chunkWritten = true;
+  }
+
+  m_chunk.clear();
+  m_chunk.reserve(ATTACHMENT_STREAM_CHUNK_SIZE);
+}
+
 void AllureAPI::addParameter(const std::string &name,
                              const std::string &value) {
   Parameter parameter{name, value};
-  if (tl_activeStep) {
-    tl_activeStep->parameters.push_back(std::move(parameter));
+  if (auto *activeStep = getActiveStep()) {
+    activeStep->parameters.push_back(std::move(parameter));
   } else {
     tl_parameters.push_back(std::move(parameter));
   }
@@ -307,18 +648,17 @@ const std::vector<AllureAPI::Parameter> &AllureAPI::getParameters() {
   return tl_parameters;
 }
 
-std::string AllureAPI::formatTMSLink(const std::string &tmsId) {
-  std::lock_guard<std::mutex> lk(g_mutex);
-  if (g_tmsPattern.empty())
-    return {};
-
-  const std::string needle = "{}";
-  const auto pos = g_tmsPattern.find(needle);
-  if (pos == std::string::npos)
-    return g_tmsPattern;
+const std::string &
+AllureAPI::Configuration::getSuiteName(const std::string &gtestSuiteName) const {
+  const auto it = suiteLabels.find(model::test_property::NAME_PROPERTY);
+  return (it != suiteLabels.end()) ? it->second : gtestSuiteName;
+}
 
-  return g_tmsPattern.substr(0, pos) + tmsId +
-         g_tmsPattern.substr(pos + needle.size());
+std::string AllureAPI::formatTMSLink(const std::string &tmsId) {
+  const auto configuration = getConfiguration();
+  const std::string gtestSuiteName = getCurrentTestSuiteName();
+  return configuration->tmsLinkTemplate.render(
+      {tmsId, configuration->getSuiteName(gtestSuiteName)});
 }
 
 service::IServicesFactory *AllureAPI::getServicesFactory() {
@@ -332,22 +672,8 @@ service::IServicesFactory *AllureAPI::getServicesFactory() {
 }
 
 model::TestCase *AllureAPI::getRunningTestCase() {
-  unsigned int nTestSuites =
-      static_cast<unsigned int>(m_testProgram.getTestSuitesCount());
-  for (unsigned int i = 0; i < nTestSuites; i++) {
-    model::TestSuite &testSuite = m_testProgram.getTestSuite(i);
-    if (testSuite.getStage() != model::Stage::RUNNING) {
-      continue;
-    }
-
-    for (model::TestCase &testCase : testSuite.getTestCases()) {
-      if (testCase.getStage() == model::Stage::RUNNING) {
-        return &testCase;
-      }
-    }
-  }
-
-  return nullptr;
+  model::TestSuite *testSuite = m_testProgram.getRunningTestSuite();
+  return testSuite ? testSuite->getRunningTestCase() : nullptr;
 }
 
 } // namespace gtest_allure
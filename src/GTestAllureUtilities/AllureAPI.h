@@ -1,11 +1,21 @@
 #pragma once
 
+#include "Model/BackPressurePolicy.h"
+#include "Model/ClockType.h"
 #include "Model/Format.h"
+#include "Model/ReportSerializer.h"
+#include "Model/StepType.h"
 #include "Model/TestProgram.h"
+#include "Model/UUIDVersion.h"
 
+#include <cstddef>
+#include <exception>
 #include <functional>
 #include <gtest/gtest.h>
 #include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
 
 #include <map>
 #include <string>
@@ -16,6 +26,7 @@ namespace gtest_allure {
 
 namespace service {
 class IServicesFactory;
+class ITimeService;
 }
 
 class AllureAPI {
@@ -36,24 +47,127 @@ public:
     std::string value;
   };
 
+  // Steps of a test case are kept in start order: nested steps follow their
+  // parent step, which records how many steps (at any depth) it contains
   struct Step {
     std::string name;
     std::string status;
     long long startMs{};
     long long stopMs{};
+    unsigned int nestedStepsCount{};
 
     std::vector<Attachment> attachments;
     std::vector<Parameter> parameters;
   };
 
+  // Suite and program settings, published as immutable versioned snapshots:
+  // setters build a new snapshot, and each thread keeps the last snapshot it
+  // read, which it only reloads (without locking) after the version changed
+  struct Configuration {
+    unsigned long long version{};
+
+    std::string outputFolder = "allure-results";
+    std::string tmsId;
+    model::LinkTemplate tmsLinkTemplate;
+    std::string description;
+    std::string epic;
+    std::string severity;
+    std::map<std::string, std::string> suiteLabels;
+
+    bool generateLegacyResults = true;
+    bool asyncResultsWriting = false;
+    size_t asyncResultsQueueCapacity = 1024;
+    model::BackPressurePolicy asyncResultsBackPressurePolicy =
+        model::BackPressurePolicy::BLOCK;
+    model::UUIDVersion resultsUUIDVersion = model::UUIDVersion::V4;
+
+    // Suite name reported in the suite label and in the {suite} placeholder of
+    // TMS links: the one given to setTestSuiteName, if any, or the given
+    // GoogleTest suite name otherwise
+    const std::string &getSuiteName(const std::string &gtestSuiteName) const;
+  };
+
+  // Reports the enclosing block as a step: started on construction and
+  // finished by end() or on destruction (broken when left by an exception).
+  // Steps started while another one is running are nested into it. Ending a
+  // step first finishes the steps still running inside it, as broken: their
+  // scopes report nothing afterwards, nor do scopes outliving the test case
+  // data of their step (see releaseTestCaseData).
+  class StepScope {
+  public:
+    explicit StepScope(const std::string &name,
+                       model::StepType type = model::StepType::ACTION_STEP);
+    ~StepScope() noexcept;
+
+    StepScope(const StepScope &) = delete;
+    StepScope &operator=(const StepScope &) = delete;
+
+    // Finishes the step, rethrowing any error found while reporting its end.
+    // Errors found when finished on destruction only make the step broken.
+    void end();
+
+  private:
+    std::exception_ptr finish(bool broken) noexcept;
+    static std::exception_ptr finishActiveStep(bool broken) noexcept;
+
+  private:
+    size_t m_stepIndex;
+    unsigned long long m_stepsGeneration;
+    int m_uncaughtExceptions;
+    bool m_ended;
+  };
+
+  // Writes an attachment file of the output folder in chunks, so that content
+  // produced along a test (e.g. a log) is never held in memory as a whole.
+  // The file is complete once the stream is closed or destroyed. Its content is
+  // not known upfront, so it is saved as <uuid>-attachment.<ext>.
+  // As for addAttachmentContent, errors saving the file are reported by
+  // flushAttachments(), and the destructor never throws.
+  class AttachmentStream {
+  public:
+    AttachmentStream(const std::string &name, const std::string &type);
+    ~AttachmentStream() noexcept;
+
+    AttachmentStream(const AttachmentStream &) = delete;
+    AttachmentStream &operator=(const AttachmentStream &) = delete;
+
+    AttachmentStream &write(std::string_view content);
+    AttachmentStream &write(std::span<const std::byte> content);
+    void close();
+
+  private:
+    void writeChunk();
+
+  private:
+    std::string m_fileName;
+    std::string m_chunk;
+    bool m_chunkWritten;
+  };
+
+  struct TestCaseData {
+    std::vector<std::string> tags;
+    std::vector<Label> labels;
+    std::vector<Step> steps;
+    std::vector<Attachment> attachments;
+    std::vector<Parameter> parameters;
+  };
+
   // Allure2Listener support
+  // Forgets the suite name given to setTestSuiteName for the previous suite
+  static void beginTestSuite();
   static void beginTestCase(const std::string &suiteName,
                             const std::string &gtestName,
                             const std::string &uuid);
   static void endTestCase();
+  // Moves tags, labels, steps, attachments and parameters recorded by the
+  // calling thread out of AllureAPI (getters return empty vectors afterwards)
+  static TestCaseData releaseTestCaseData();
 
   // ===== Allure2Listener getters =====
-  // ===== Allure2Listener getters =====
+  // Keeps the snapshot alive as long as the returned pointer, so that several
+  // settings can be read from the same snapshot without copying them. The
+  // library reads settings this way: getters below return copies.
+  static std::shared_ptr<const Configuration> getConfiguration();
   static std::string getOutputFolder();
 
   static std::string getCurrentTestSuiteName();
@@ -63,7 +177,7 @@ public:
   static std::string getTestSuiteEpic();
   static std::string getTestSuiteSeverity();
   static std::string getDescription();
-  static const std::map<std::string, std::string> &getTestSuiteLabels();
+  static std::map<std::string, std::string> getTestSuiteLabels();
 
   static const std::vector<Step> &getSteps();
   static std::string formatTMSLink(const std::string &tmsId);
@@ -75,9 +189,33 @@ public:
   static void setOutputFolder(const std::string &);
   static void setTMSLinksPattern(const std::string &);
   static void setFormat(model::Format format);
+  static void setClockType(model::ClockType);
+  static model::ClockType getClockType();
+  // Threads serializing legacy report files at program end (0: one per core)
+  static void setReportWorkersCount(unsigned int);
+  static unsigned int getReportWorkersCount();
+  // Save each legacy report file as soon as its test suite ends
+  static void setIncrementalReports(bool enable);
+  static bool getIncrementalReports();
+  // Backend writing legacy report files (JSON document by default)
+  static void setReportSerializer(model::ReportSerializer);
+  static model::ReportSerializer getReportSerializer();
+  static const service::ITimeService &getTimeService();
   static void setGenerateLegacyResults(bool enable);
   static bool getGenerateLegacyResults();
 
+  // Allure2Listener result files writing (synchronous by default)
+  static void setAsyncResultsWriting(bool enable);
+  static bool getAsyncResultsWriting();
+  static void setAsyncResultsQueueCapacity(size_t capacity);
+  static size_t getAsyncResultsQueueCapacity();
+  static void setAsyncResultsBackPressurePolicy(model::BackPressurePolicy);
+  static model::BackPressurePolicy getAsyncResultsBackPressurePolicy();
+
+  // UUID version of Allure2 result file names (V7 sorts in execution order)
+  static void setResultsUUIDVersion(model::UUIDVersion);
+  static model::UUIDVersion getResultsUUIDVersion();
+
   static void setTMSId(const std::string &);
   static void setTestSuiteName(const std::string &);
   static void setTestSuiteDescription(const std::string &);
@@ -90,6 +228,23 @@ public:
   static void addAction(const std::string &name, std::function<void()>);
   static void addExpectedResult(const std::string &name, std::function<void()>);
 
+  // Invoke the given callable in place: no std::function, no allocation
+  template <typename ActionFunction>
+  static void addAction(const std::string &name,
+                        ActionFunction &&actionFunction) {
+    StepScope step(name, model::StepType::ACTION_STEP);
+    std::forward<ActionFunction>(actionFunction)();
+    step.end();
+  }
+
+  template <typename VerificationFunction>
+  static void addExpectedResult(const std::string &name,
+                                VerificationFunction &&verificationFunction) {
+    StepScope step(name, model::StepType::EXPECTED_RESULT_STEP);
+    std::forward<VerificationFunction>(verificationFunction)();
+    step.end();
+  }
+
   // tags
   static void addTag(const std::string &tag);
   static const std::vector<std::string> &getTags();
@@ -101,16 +256,30 @@ public:
   // attachments
   static void addAttachment(const std::string &name, const std::string &type,
                             const std::string &filePath);
+  // Content is saved as <hash>-attachment.<ext> into the output folder by a
+  // writer thread (see setAttachmentsPendingBytesCapacity). Attachments with
+  // the same content and type share a single file, saved once.
+  static void addAttachmentContent(const std::string &name,
+                                   const std::string &type,
+                                   std::string_view content);
+  static void addAttachment(const std::string &name, const std::string &type,
+                            std::span<const std::byte> content);
   static const std::vector<Attachment> &getAttachments();
 
+  // Attachment bytes waiting to be saved; callers block while it is exceeded
+  static void setAttachmentsPendingBytesCapacity(size_t capacity);
+  static size_t getAttachmentsPendingBytesCapacity();
+  // Waits until all attachment files are saved (done by Allure2Listener when
+  // the test program ends)
+  static void flushAttachments();
+
   // parameters
   static void addParameter(const std::string &name, const std::string &value);
   static const std::vector<Parameter> &getParameters();
 
 private:
-  static void addStep(const std::string &name, bool isAction,
-                      std::function<void()>);
   static service::IServicesFactory *getServicesFactory();
+  static model::TestCase *getRunningTestCase();
 
 private:
   static model::TestProgram m_testProgram;
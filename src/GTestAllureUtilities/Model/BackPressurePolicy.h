@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	enum class BackPressurePolicy
+	{
+		BLOCK = 0,
+		SPILL_SYNCHRONOUSLY = 1
+	};
+
+}}}
@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	enum class ClockType
+	{
+		PRECISE = 0,
+		COARSE = 1
+	};
+
+}}}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Stage.h"
+
+#include <cstddef>
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	// Index of the RUNNING item of a model container (test suites of a program,
+	// test cases of a suite or steps of a test case). The owner moves it forward
+	// when a running item is added, so looking up the running item is O(1).
+	// When the cursor is stale (item finished, or container edited directly), it
+	// is recomputed by scanning from the most recently added item backwards.
+	class ExecutionCursor
+	{
+	public:
+		ExecutionCursor()
+			:m_index(NO_INDEX)
+		{
+		}
+
+		void reset()
+		{
+			m_index = NO_INDEX;
+		}
+
+		template <typename Container>
+		void onItemAdded(const Container& items)
+		{
+			if (items.back().getStage() == Stage::RUNNING)
+			{
+				m_index = items.size() - 1;
+			}
+		}
+
+		template <typename Container>
+		auto getRunningItem(Container& items) -> decltype(&items.front())
+		{
+			if ((m_index < items.size()) && (items[m_index].getStage() == Stage::RUNNING))
+			{
+				return &items[m_index];
+			}
+
+			for (size_t i = items.size(); i > 0; i--)
+			{
+				if (items[i - 1].getStage() == Stage::RUNNING)
+				{
+					m_index = i - 1;
+					return &items[m_index];
+				}
+			}
+
+			m_index = NO_INDEX;
+			return nullptr;
+		}
+
+	private:
+		static constexpr size_t NO_INDEX = static_cast<size_t>(-1);
+		size_t m_index;
+	};
+
+}}}
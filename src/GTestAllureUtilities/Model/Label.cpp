@@ -1,5 +1,7 @@
 #include "Label.h"
 
+#include <utility>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
@@ -15,6 +17,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 	{
 	}
 
+	Label::Label(Label&& other) noexcept
+		:m_name(std::move(other.m_name))
+		,m_value(std::move(other.m_value))
+	{
+	}
+
 	std::string Label::getName() const
 	{
 		return m_name;
@@ -42,6 +50,13 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return *this;
 	}
 
+	Label& Label::operator= (Label&& other) noexcept
+	{
+		m_name = std::move(other.m_name);
+		m_value = std::move(other.m_value);
+		return *this;
+	}
+
 	bool operator== (const Label& lhs, const Label& rhs)
 	{
 		return (lhs.m_name == rhs.m_name) &&
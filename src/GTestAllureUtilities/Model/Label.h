@@ -10,6 +10,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 	public:
 		Label();
 		Label(const Label&);
+		Label(Label&&) noexcept;
 		virtual ~Label() = default;
 
 		std::string getName() const;
@@ -19,6 +20,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 		void setValue(const std::string&);
 
 		virtual Label& operator= (const Label&);
+		virtual Label& operator= (Label&&) noexcept;
 		friend bool operator== (const Label& lhs, const Label& rhs);
 		friend bool operator!= (const Label& lhs, const Label& rhs);
 
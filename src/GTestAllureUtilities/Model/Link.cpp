@@ -1,5 +1,7 @@
 #include "Link.h"
 
+#include <utility>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
@@ -17,6 +19,13 @@ namespace systelab { namespace gtest_allure { namespace model {
 	{
 	}
 
+	Link::Link(Link&& other) noexcept
+		:m_name(std::move(other.m_name))
+		,m_url(std::move(other.m_url))
+		,m_type(std::move(other.m_type))
+	{
+	}
+
 	std::string Link::getName() const
 	{
 		return m_name;
@@ -55,6 +64,14 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return *this;
 	}
 
+	Link& Link::operator= (Link&& other) noexcept
+	{
+		m_name = std::move(other.m_name);
+		m_url = std::move(other.m_url);
+		m_type = std::move(other.m_type);
+		return *this;
+	}
+
 	bool operator== (const Link& lhs, const Link& rhs)
 	{
 		return (lhs.m_name == rhs.m_name) &&
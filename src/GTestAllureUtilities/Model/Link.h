@@ -10,6 +10,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 	public:
 		Link();
 		Link(const Link&);
+		Link(Link&&) noexcept;
 		virtual ~Link() = default;
 
 		std::string getName() const;
@@ -21,6 +22,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 		void setType(const std::string&);
 
 		virtual Link& operator= (const Link&);
+		virtual Link& operator= (Link&&) noexcept;
 		friend bool operator== (const Link& lhs, const Link& rhs);
 		friend bool operator!= (const Link& lhs, const Link& rhs);
 
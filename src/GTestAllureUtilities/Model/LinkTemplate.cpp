@@ -0,0 +1,156 @@
+#include "LinkTemplate.h"
+
+#include <utility>
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	LinkTemplate::LinkTemplate()
+		:m_pattern("")
+		,m_segments()
+	{
+	}
+
+	LinkTemplate::LinkTemplate(const std::string& pattern)
+		:m_pattern(pattern)
+		,m_segments()
+	{
+		compile();
+	}
+
+	LinkTemplate::LinkTemplate(const LinkTemplate& other)
+		:m_pattern(other.m_pattern)
+		,m_segments(other.m_segments)
+	{
+	}
+
+	LinkTemplate::LinkTemplate(LinkTemplate&& other) noexcept
+		:m_pattern(std::move(other.m_pattern))
+		,m_segments(std::move(other.m_segments))
+	{
+	}
+
+	const std::string& LinkTemplate::getPattern() const
+	{
+		return m_pattern;
+	}
+
+	bool LinkTemplate::isEmpty() const
+	{
+		return m_pattern.empty();
+	}
+
+	bool LinkTemplate::hasPlaceholders() const
+	{
+		for (const auto& segment : m_segments)
+		{
+			if (segment.type != SegmentType::LITERAL)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	size_t LinkTemplate::getRenderedSize(const Values& values) const
+	{
+		size_t size = 0;
+		for (const auto& segment : m_segments)
+		{
+			size += getSegmentText(segment, values).size();
+		}
+
+		return size;
+	}
+
+	void LinkTemplate::render(const Values& values, std::string& output) const
+	{
+		output.reserve(output.size() + getRenderedSize(values));
+		for (const auto& segment : m_segments)
+		{
+			output.append(getSegmentText(segment, values));
+		}
+	}
+
+	std::string LinkTemplate::render(const Values& values) const
+	{
+		std::string output;
+		render(values, output);
+		return output;
+	}
+
+	void LinkTemplate::compile()
+	{
+		static constexpr std::string_view placeholders[] = { "{}", "{id}", "{suite}" };
+		static constexpr SegmentType placeholderTypes[] = { SegmentType::ID, SegmentType::ID, SegmentType::SUITE };
+
+		const std::string_view pattern = m_pattern;
+		size_t literalStart = 0;
+		size_t position = pattern.find('{');
+		while (position != std::string_view::npos)
+		{
+			size_t placeholderLength = 0;
+			for (size_t i = 0; i < std::size(placeholders); i++)
+			{
+				if (pattern.compare(position, placeholders[i].size(), placeholders[i]) == 0)
+				{
+					if (position > literalStart)
+					{
+						m_segments.push_back({ SegmentType::LITERAL, literalStart, position - literalStart });
+					}
+
+					placeholderLength = placeholders[i].size();
+					m_segments.push_back({ placeholderTypes[i], position, placeholderLength });
+					literalStart = position + placeholderLength;
+					break;
+				}
+			}
+
+			position = pattern.find('{', position + ((placeholderLength > 0) ? placeholderLength : 1));
+		}
+
+		if (literalStart < pattern.size())
+		{
+			m_segments.push_back({ SegmentType::LITERAL, literalStart, pattern.size() - literalStart });
+		}
+	}
+
+	std::string_view LinkTemplate::getSegmentText(const Segment& segment, const Values& values) const
+	{
+		switch (segment.type)
+		{
+			case SegmentType::ID:
+				return values.id;
+			case SegmentType::SUITE:
+				return values.suite;
+			default:
+				return std::string_view(m_pattern).substr(segment.offset, segment.length);
+		}
+	}
+
+	LinkTemplate& LinkTemplate::operator= (const LinkTemplate& other)
+	{
+		m_pattern = other.m_pattern;
+		m_segments = other.m_segments;
+		return *this;
+	}
+
+	LinkTemplate& LinkTemplate::operator= (LinkTemplate&& other) noexcept
+	{
+		m_pattern = std::move(other.m_pattern);
+		m_segments = std::move(other.m_segments);
+		return *this;
+	}
+
+	bool operator== (const LinkTemplate& lhs, const LinkTemplate& rhs)
+	{
+		return (lhs.m_pattern == rhs.m_pattern);
+	}
+
+	bool operator!= (const LinkTemplate& lhs, const LinkTemplate& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+}}}
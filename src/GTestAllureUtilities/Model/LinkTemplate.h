@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	// Link pattern parsed once into literal and placeholder segments.
+	// Recognizes "{}" and "{id}" (TMS identifier) and "{suite}" (test suite name);
+	// any other brace sequence is kept as literal text.
+	class LinkTemplate
+	{
+	public:
+		struct Values
+		{
+			std::string_view id;
+			std::string_view suite;
+		};
+
+	public:
+		LinkTemplate();
+		explicit LinkTemplate(const std::string& pattern);
+		LinkTemplate(const LinkTemplate&);
+		LinkTemplate(LinkTemplate&&) noexcept;
+		virtual ~LinkTemplate() = default;
+
+		const std::string& getPattern() const;
+		bool isEmpty() const;
+		bool hasPlaceholders() const;
+
+		size_t getRenderedSize(const Values&) const;
+		void render(const Values&, std::string& output) const;
+		std::string render(const Values&) const;
+
+		virtual LinkTemplate& operator= (const LinkTemplate&);
+		virtual LinkTemplate& operator= (LinkTemplate&&) noexcept;
+		friend bool operator== (const LinkTemplate& lhs, const LinkTemplate& rhs);
+		friend bool operator!= (const LinkTemplate& lhs, const LinkTemplate& rhs);
+
+	private:
+		enum class SegmentType
+		{
+			LITERAL = 0,
+			ID = 1,
+			SUITE = 2
+		};
+
+		struct Segment
+		{
+			SegmentType type;
+			size_t offset;
+			size_t length;
+		};
+
+		void compile();
+		std::string_view getSegmentText(const Segment&, const Values&) const;
+
+	private:
+		std::string m_pattern;
+		std::vector<Segment> m_segments;
+	};
+
+}}}
@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	enum class ReportSerializer
+	{
+		JSON_DOCUMENT = 0,
+		JSON_STREAM = 1
+	};
+
+}}}
@@ -1,54 +1,109 @@
 #include "Step.h"
 
-#include "Stage.h"
-#include "Status.h"
+#include <utility>
 
 
 namespace systelab { namespace gtest_allure { namespace model {
 
 	Step::Step()
-		:m_name("")
-		,m_status(Status::UNKNOWN)
-		,m_stage(Stage::PENDING)
+		:Step(StepType::ACTION_STEP)
+	{
+	}
+
+	Step::Step(StepType stepType)
+		:Step(stepType, allocator_type())
+	{
+	}
+
+	Step::Step(StepType stepType, const allocator_type& allocator)
+		:m_name(allocator)
 		,m_start(0)
 		,m_stop(0)
+		,m_stepType(stepType)
+		,m_status(Status::UNKNOWN)
+		,m_stage(Stage::PENDING)
+		,m_nestedStepsCount(0)
 	{
 	}
 
 	Step::Step(const Step& other)
-		:m_name(other.m_name)
+		:Step(other, allocator_type())
+	{
+	}
+
+	Step::Step(const Step& other, const allocator_type& allocator)
+		:m_name(other.m_name, allocator)
+		,m_start(other.m_start)
+		,m_stop(other.m_stop)
+		,m_stepType(other.m_stepType)
+		,m_status(other.m_status)
+		,m_stage(other.m_stage)
+		,m_nestedStepsCount(other.m_nestedStepsCount)
+	{
+	}
+
+	Step::Step(Step&& other) noexcept
+		:m_name(std::move(other.m_name))
+		,m_start(other.m_start)
+		,m_stop(other.m_stop)
+		,m_stepType(other.m_stepType)
 		,m_status(other.m_status)
 		,m_stage(other.m_stage)
+		,m_nestedStepsCount(other.m_nestedStepsCount)
+	{
+	}
+
+	Step::Step(Step&& other, const allocator_type& allocator)
+		:m_name(std::move(other.m_name), allocator)
 		,m_start(other.m_start)
 		,m_stop(other.m_stop)
+		,m_stepType(other.m_stepType)
+		,m_status(other.m_status)
+		,m_stage(other.m_stage)
+		,m_nestedStepsCount(other.m_nestedStepsCount)
+	{
+	}
+
+	StepType Step::getStepType() const
 	{
+		return m_stepType;
 	}
 
 	std::string Step::getName() const
 	{
-		return m_name;
+		return std::string(m_name);
 	}
 
-	model::Status Step::getStatus() const
+	Status Step::getStatus() const
 	{
 		return m_status;
 	}
 
-	model::Stage Step::getStage() const
+	Stage Step::getStage() const
 	{
 		return m_stage;
 	}
 
-	time_t Step::getStart() const
+	int64_t Step::getStart() const
 	{
 		return m_start;
 	}
 
-	time_t Step::getStop() const
+	int64_t Step::getStop() const
 	{
 		return m_stop;
 	}
 
+	unsigned int Step::getNestedStepsCount() const
+	{
+		return m_nestedStepsCount;
+	}
+
+	void Step::setStepType(StepType stepType)
+	{
+		m_stepType = stepType;
+	}
+
 	void Step::setName(const std::string& name)
 	{
 		m_name = name;
@@ -64,34 +119,56 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_stage = stage;
 	}
 
-	void Step::setStart(time_t start)
+	void Step::setStart(int64_t start)
 	{
 		m_start = start;
 	}
 
-	void Step::setStop(time_t stop)
+	void Step::setStop(int64_t stop)
 	{
 		m_stop = stop;
 	}
 
+	void Step::setNestedStepsCount(unsigned int nestedStepsCount)
+	{
+		m_nestedStepsCount = nestedStepsCount;
+	}
+
 	Step& Step::operator= (const Step& other)
 	{
 		m_name = other.m_name;
+		m_start = other.m_start;
+		m_stop = other.m_stop;
+		m_stepType = other.m_stepType;
 		m_status = other.m_status;
 		m_stage = other.m_stage;
+		m_nestedStepsCount = other.m_nestedStepsCount;
+
+		return *this;
+	}
+
+	Step& Step::operator= (Step&& other)
+	{
+		m_name = std::move(other.m_name);
 		m_start = other.m_start;
 		m_stop = other.m_stop;
+		m_stepType = other.m_stepType;
+		m_status = other.m_status;
+		m_stage = other.m_stage;
+		m_nestedStepsCount = other.m_nestedStepsCount;
 
 		return *this;
 	}
 
 	bool operator== (const Step& lhs, const Step& rhs)
 	{
-		return (lhs.m_name == rhs.m_name) &&
+		return (lhs.m_stepType == rhs.m_stepType) &&
+			   (lhs.m_name == rhs.m_name) &&
 			   (lhs.m_status == rhs.m_status) &&
 			   (lhs.m_stage == rhs.m_stage) &&
 			   (lhs.m_start == rhs.m_start) &&
-			   (lhs.m_stop == rhs.m_stop);
+			   (lhs.m_stop == rhs.m_stop) &&
+			   (lhs.m_nestedStepsCount == rhs.m_nestedStepsCount);
 	}
 
 	bool operator!= (const Step& lhs, const Step& rhs)
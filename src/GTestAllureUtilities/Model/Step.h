@@ -1,47 +1,68 @@
 #pragma once
 
+#include "Stage.h"
+#include "Status.h"
+#include "StepType.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <string>
-#include <vector>
 
 
 namespace systelab { namespace gtest_allure { namespace model {
 
-	enum class Stage;
-	enum class Status;
-	enum class StepType;
-
+	// Plain step record: actions and expected results only differ by their type
+	// tag, so steps are stored by value and contiguously in their TestCase, one
+	// record per step (fields are not split into separate arrays).
+	// Allocator-aware: when stored in a TestCase, its name is allocated from the
+	// program arena.
+	// Nested steps are stored right after their parent step, which records how
+	// many steps (at any depth) are nested into it.
 	class Step
 	{
+	public:
+		using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
 	public:
 		Step();
+		explicit Step(StepType);
+		Step(StepType, const allocator_type&);
 		Step(const Step&);
-		virtual ~Step() = default;
-
-		virtual StepType getStepType() const = 0;
-		virtual Step* clone() const = 0;
+		Step(const Step&, const allocator_type&);
+		Step(Step&&) noexcept;
+		Step(Step&&, const allocator_type&);
+		~Step() = default;
 
+		StepType getStepType() const;
 		std::string getName() const;
 		Status getStatus() const;
 		Stage getStage() const;
-		time_t getStart() const;
-		time_t getStop() const;
+		int64_t getStart() const;
+		int64_t getStop() const;
+		unsigned int getNestedStepsCount() const;
 
+		void setStepType(StepType);
 		void setName(const std::string&);
 		void setStatus(Status);
 		void setStage(Stage);
-		void setStart(time_t);
-		void setStop(time_t);
+		void setStart(int64_t);
+		void setStop(int64_t);
+		void setNestedStepsCount(unsigned int);
 
-		virtual Step& operator= (const Step&);
+		Step& operator= (const Step&);
+		Step& operator= (Step&&);
 		friend bool operator== (const Step& lhs, const Step& rhs);
 		friend bool operator!= (const Step& lhs, const Step& rhs);
 
 	private:
-		std::string m_name;
+		std::pmr::string m_name;
+		int64_t m_start;
+		int64_t m_stop;
+		StepType m_stepType;
 		Status m_status;
 		Stage m_stage;
-		time_t m_start;
-		time_t m_stop;
+		unsigned int m_nestedStepsCount;
 	};
 
 }}}
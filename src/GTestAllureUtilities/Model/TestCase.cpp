@@ -1,35 +1,71 @@
 #include "TestCase.h"
 
+#include <utility>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
 	TestCase::TestCase()
-		:m_name("")
+		:TestCase(allocator_type())
+	{
+	}
+
+	TestCase::TestCase(const allocator_type& allocator)
+		:m_name(allocator)
 		,m_status(Status::UNKNOWN)
 		,m_stage(Stage::PENDING)
 		,m_start(0)
 		,m_stop(0)
-		,m_steps()
+		,m_steps(allocator)
+		,m_runningStepCursor()
+		,m_tags(allocator)
 	{
 	}
 
 	TestCase::TestCase(const TestCase& other)
-		:m_name(other.m_name)
+		:TestCase(other, allocator_type())
+	{
+	}
+
+	TestCase::TestCase(const TestCase& other, const allocator_type& allocator)
+		:m_name(other.m_name, allocator)
 		,m_status(other.m_status)
 		,m_stage(other.m_stage)
 		,m_start(other.m_start)
 		,m_stop(other.m_stop)
-		,m_steps()
+		,m_steps(other.m_steps, allocator)
+		,m_runningStepCursor(other.m_runningStepCursor)
+		,m_tags(other.m_tags, allocator)
+	{
+	}
+
+	TestCase::TestCase(TestCase&& other) noexcept
+		:m_name(std::move(other.m_name))
+		,m_status(other.m_status)
+		,m_stage(other.m_stage)
+		,m_start(other.m_start)
+		,m_stop(other.m_stop)
+		,m_steps(std::move(other.m_steps))
+		,m_runningStepCursor(other.m_runningStepCursor)
+		,m_tags(std::move(other.m_tags))
+	{
+	}
+
+	TestCase::TestCase(TestCase&& other, const allocator_type& allocator)
+		:m_name(std::move(other.m_name), allocator)
+		,m_status(other.m_status)
+		,m_stage(other.m_stage)
+		,m_start(other.m_start)
+		,m_stop(other.m_stop)
+		,m_steps(std::move(other.m_steps), allocator)
+		,m_runningStepCursor(other.m_runningStepCursor)
+		,m_tags(std::move(other.m_tags), allocator)
 	{
-		for (const auto& step : other.m_steps)
-		{
-			m_steps.push_back(std::unique_ptr<Step>(step->clone()));
-		}
 	}
 
 	std::string TestCase::getName() const
 	{
-		return m_name;
+		return std::string(m_name);
 	}
 
 	Status TestCase::getStatus() const
@@ -42,12 +78,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return m_stage;
 	}
 
-	time_t TestCase::getStart() const
+	int64_t TestCase::getStart() const
 	{
 		return m_start;
 	}
 
-	time_t TestCase::getStop() const
+	int64_t TestCase::getStop() const
 	{
 		return m_stop;
 	}
@@ -67,12 +103,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_stage = stage;
 	}
 
-	void TestCase::setStart(time_t start)
+	void TestCase::setStart(int64_t start)
 	{
 		m_start = start;
 	}
 
-	void TestCase::setStop(time_t stop)
+	void TestCase::setStop(int64_t stop)
 	{
 		m_stop = stop;
 	}
@@ -84,17 +120,50 @@ namespace systelab { namespace gtest_allure { namespace model {
 
 	const Step* TestCase::getStep(unsigned int index) const
 	{
-		return m_steps[index].get();
+		return &m_steps[index];
 	}
 
 	Step* TestCase::getStep(unsigned int index)
 	{
-		return m_steps[index].get();
+		return &m_steps[index];
+	}
+
+	Step* TestCase::getRunningStep()
+	{
+		return m_runningStepCursor.getRunningItem(m_steps);
 	}
 
-	void TestCase::addStep(std::unique_ptr<Step> step)
+	const std::pmr::vector<Step>& TestCase::getSteps() const
 	{
-		m_steps.push_back(std::move(step));
+		return m_steps;
+	}
+
+	void TestCase::addStep(const Step& step)
+	{
+		m_steps.push_back(step);
+		m_runningStepCursor.onItemAdded(m_steps);
+	}
+
+	Step& TestCase::emplaceStep(StepType stepType, const std::string& name, int64_t start)
+	{
+		Step& step = m_steps.emplace_back(stepType);
+		step.setName(name);
+		step.setStart(start);
+		step.setStage(Stage::RUNNING);
+		step.setStatus(Status::UNKNOWN);
+
+		m_runningStepCursor.onItemAdded(m_steps);
+		return step;
+	}
+
+	const std::pmr::vector<std::pmr::string>& TestCase::getTags() const
+	{
+		return m_tags;
+	}
+
+	void TestCase::addTag(const std::string& tag)
+	{
+		m_tags.emplace_back(tag);
 	}
 
 	TestCase& TestCase::operator= (const TestCase& other)
@@ -105,11 +174,24 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_start = other.m_start;
 		m_stop = other.m_stop;
 
-		m_steps = std::vector< std::unique_ptr<Step> >();
-		for (const auto& step : other.m_steps)
-		{
-			m_steps.push_back(std::unique_ptr<Step>(step->clone()));
-		}
+		m_steps = other.m_steps;
+		m_runningStepCursor = other.m_runningStepCursor;
+
+		m_tags = other.m_tags;
+
+		return *this;
+	}
+
+	TestCase& TestCase::operator= (TestCase&& other)
+	{
+		m_name = std::move(other.m_name);
+		m_status = other.m_status;
+		m_stage = other.m_stage;
+		m_start = other.m_start;
+		m_stop = other.m_stop;
+		m_steps = std::move(other.m_steps);
+		m_runningStepCursor = other.m_runningStepCursor;
+		m_tags = std::move(other.m_tags);
 
 		return *this;
 	}
@@ -129,7 +211,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 		unsigned int nSteps = (unsigned int) lhs.m_steps.size();
 		for (unsigned int i = 0; i < nSteps; i++)
 		{
-			if ((*lhs.m_steps[i]) != (*rhs.m_steps[i]))
+			if (lhs.m_steps[i] != rhs.m_steps[i])
 			{
 				return false;
 			}
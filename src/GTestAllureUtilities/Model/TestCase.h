@@ -1,52 +1,74 @@
 #pragma once
 
+#include "ExecutionCursor.h"
 #include "Stage.h"
 #include "Status.h"
 #include "Step.h"
 
-#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
 
 namespace systelab { namespace gtest_allure { namespace model {
 
+	// Allocator-aware: when stored in a TestSuite, its name, steps and tags are
+	// allocated from the program arena.
 	class TestCase
 	{
+	public:
+		using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
 	public:
 		TestCase();
+		explicit TestCase(const allocator_type&);
 		TestCase(const TestCase&);
+		TestCase(const TestCase&, const allocator_type&);
+		TestCase(TestCase&&) noexcept;
+		TestCase(TestCase&&, const allocator_type&);
 		virtual ~TestCase() = default;
 
 		std::string getName() const;
 		Status getStatus() const;
 		Stage getStage() const;
-		time_t getStart() const;
-		time_t getStop() const;
+		int64_t getStart() const;
+		int64_t getStop() const;
 
 		void setName(const std::string&);
 		void setStatus(Status);
 		void setStage(Stage);
-		void setStart(time_t);
-		void setStop(time_t);
+		void setStart(int64_t);
+		void setStop(int64_t);
 
 		unsigned int getStepCount() const;
 		const Step* getStep(unsigned int index) const;
 		Step* getStep(unsigned int index);
-		void addStep(std::unique_ptr<Step>);
+		Step* getRunningStep();
+		const std::pmr::vector<Step>& getSteps() const;
+		void addStep(const Step&);
+		// Builds a running step in place, straight with the test case allocator
+		Step& emplaceStep(StepType, const std::string& name, int64_t start);
+
+		const std::pmr::vector<std::pmr::string>& getTags() const;
+		void addTag(const std::string&);
 
 		virtual TestCase& operator= (const TestCase&);
+		virtual TestCase& operator= (TestCase&&);
 		friend bool operator== (const TestCase& lhs, const TestCase& rhs);
 		friend bool operator!= (const TestCase& lhs, const TestCase& rhs);
 
 	private:
-		std::string m_name;
+		std::pmr::string m_name;
 		Status m_status;
 		Stage m_stage;
-		time_t m_start;
-		time_t m_stop;
+		int64_t m_start;
+		int64_t m_stop;
 
-		std::vector< std::unique_ptr<Step> > m_steps;
+		std::pmr::vector<Step> m_steps;
+		ExecutionCursor m_runningStepCursor;
+		std::pmr::vector<std::pmr::string> m_tags;
 	};
 
 }}}
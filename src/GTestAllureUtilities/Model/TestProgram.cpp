@@ -1,24 +1,54 @@
 #include "TestProgram.h"
 
+#include <utility>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
 	TestProgram::TestProgram()
 		:m_name()
 		,m_outputFolder(".")
-		,m_tmsLinksPattern("http://{}")
-		,m_testSuites()
+		,m_tmsLinkTemplate("http://{}")
+		,m_arena()
+		,m_testSuites(&m_arena)
+		,m_runningTestSuiteCursor()
 		,m_format(Format::DEFAULT)
+		,m_clockType(ClockType::PRECISE)
+		,m_reportWorkersCount(1)
+		,m_incrementalReports(false)
+		,m_reportSerializer(ReportSerializer::JSON_DOCUMENT)
 	{
 	}
 
 	TestProgram::TestProgram(const TestProgram& other)
 		:m_name(other.m_name)
 		,m_outputFolder(other.m_outputFolder)
-		,m_tmsLinksPattern(other.m_tmsLinksPattern)
-		,m_testSuites(other.m_testSuites)
+		,m_tmsLinkTemplate(other.m_tmsLinkTemplate)
+		,m_arena()
+		,m_testSuites(other.m_testSuites, &m_arena)
+		,m_runningTestSuiteCursor(other.m_runningTestSuiteCursor)
+		,m_format(other.m_format)
+		,m_clockType(other.m_clockType)
+		,m_reportWorkersCount(other.m_reportWorkersCount)
+		,m_incrementalReports(other.m_incrementalReports)
+		,m_reportSerializer(other.m_reportSerializer)
+	{
+	}
+
+	TestProgram::TestProgram(TestProgram&& other)
+		:m_name(std::move(other.m_name))
+		,m_outputFolder(std::move(other.m_outputFolder))
+		,m_tmsLinkTemplate(std::move(other.m_tmsLinkTemplate))
+		,m_arena()
+		,m_testSuites(std::move(other.m_testSuites), &m_arena)
+		,m_runningTestSuiteCursor(other.m_runningTestSuiteCursor)
 		,m_format(other.m_format)
+		,m_clockType(other.m_clockType)
+		,m_reportWorkersCount(other.m_reportWorkersCount)
+		,m_incrementalReports(other.m_incrementalReports)
+		,m_reportSerializer(other.m_reportSerializer)
 	{
+		other.clearTestSuites();
 	}
 
 	std::string TestProgram::getName() const
@@ -33,7 +63,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 
 	std::string TestProgram::getTMSLinksPattern() const
 	{
-		return m_tmsLinksPattern;
+		return m_tmsLinkTemplate.getPattern();
+	}
+
+	const LinkTemplate& TestProgram::getTMSLinkTemplate() const
+	{
+		return m_tmsLinkTemplate;
 	}
 
 	Format TestProgram::getFormat() const
@@ -41,6 +76,26 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return m_format;
 	}
 
+	ClockType TestProgram::getClockType() const
+	{
+		return m_clockType;
+	}
+
+	unsigned int TestProgram::getReportWorkersCount() const
+	{
+		return m_reportWorkersCount;
+	}
+
+	bool TestProgram::getIncrementalReports() const
+	{
+		return m_incrementalReports;
+	}
+
+	ReportSerializer TestProgram::getReportSerializer() const
+	{
+		return m_reportSerializer;
+	}
+
 	void TestProgram::setName(const std::string& name)
 	{
 		m_name = name;
@@ -53,7 +108,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 
 	void TestProgram::setTMSLinksPattern(const std::string& tmsLinksPattern)
 	{
-		m_tmsLinksPattern = tmsLinksPattern;
+		m_tmsLinkTemplate = LinkTemplate(tmsLinksPattern);
 	}
 
 	void TestProgram::setFormat(Format format)
@@ -61,6 +116,26 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_format = format;
 	}
 
+	void TestProgram::setClockType(ClockType clockType)
+	{
+		m_clockType = clockType;
+	}
+
+	void TestProgram::setReportWorkersCount(unsigned int reportWorkersCount)
+	{
+		m_reportWorkersCount = reportWorkersCount;
+	}
+
+	void TestProgram::setIncrementalReports(bool incrementalReports)
+	{
+		m_incrementalReports = incrementalReports;
+	}
+
+	void TestProgram::setReportSerializer(ReportSerializer reportSerializer)
+	{
+		m_reportSerializer = reportSerializer;
+	}
+
 	size_t TestProgram::getTestSuitesCount() const
 	{
 		return m_testSuites.size();
@@ -76,22 +151,71 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return m_testSuites[index];
 	}
 
+	TestSuite* TestProgram::getRunningTestSuite()
+	{
+		return m_runningTestSuiteCursor.getRunningItem(m_testSuites);
+	}
+
 	void TestProgram::addTestSuite(const TestSuite& testSuite)
 	{
 		m_testSuites.push_back(testSuite);
+		m_runningTestSuiteCursor.onItemAdded(m_testSuites);
+	}
+
+	void TestProgram::addTestSuite(TestSuite&& testSuite)
+	{
+		m_testSuites.push_back(std::move(testSuite));
+		m_runningTestSuiteCursor.onItemAdded(m_testSuites);
+	}
+
+	TestSuite& TestProgram::emplaceTestSuite(const std::string& uuid, const std::string& name, int64_t start)
+	{
+		TestSuite& testSuite = m_testSuites.emplace_back();
+		testSuite.setUUID(uuid);
+		testSuite.setName(name);
+		testSuite.setStart(start);
+		testSuite.setStage(Stage::RUNNING);
+		testSuite.setStatus(Status::UNKNOWN);
+
+		m_runningTestSuiteCursor.onItemAdded(m_testSuites);
+		return testSuite;
 	}
 
 	void TestProgram::clearTestSuites()
 	{
 		m_testSuites.clear();
+		m_runningTestSuiteCursor.reset();
 	}
 
 	TestProgram& TestProgram::operator= (const TestProgram& other)
 	{
 		m_name = other.m_name;
 		m_outputFolder = other.m_outputFolder;
-		m_tmsLinksPattern = other.m_tmsLinksPattern;
+		m_tmsLinkTemplate = other.m_tmsLinkTemplate;
 		m_testSuites = other.m_testSuites;
+		m_runningTestSuiteCursor = other.m_runningTestSuiteCursor;
+		m_format = other.m_format;
+		m_clockType = other.m_clockType;
+		m_reportWorkersCount = other.m_reportWorkersCount;
+		m_incrementalReports = other.m_incrementalReports;
+		m_reportSerializer = other.m_reportSerializer;
+		return *this;
+	}
+
+	TestProgram& TestProgram::operator= (TestProgram&& other)
+	{
+		m_name = std::move(other.m_name);
+		m_outputFolder = std::move(other.m_outputFolder);
+		m_tmsLinkTemplate = std::move(other.m_tmsLinkTemplate);
+		// Allocators of both pools differ, so suites are moved one by one into this pool
+		m_testSuites = std::move(other.m_testSuites);
+		m_runningTestSuiteCursor = other.m_runningTestSuiteCursor;
+		m_format = other.m_format;
+		m_clockType = other.m_clockType;
+		m_reportWorkersCount = other.m_reportWorkersCount;
+		m_incrementalReports = other.m_incrementalReports;
+		m_reportSerializer = other.m_reportSerializer;
+		other.clearTestSuites();
 		return *this;
 	}
 
@@ -99,7 +223,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 	{
 		return (lhs.m_name == rhs.m_name) &&
 			   (lhs.m_outputFolder == rhs.m_outputFolder) &&
-			   (lhs.m_tmsLinksPattern == rhs.m_tmsLinksPattern) &&
+			   (lhs.m_tmsLinkTemplate == rhs.m_tmsLinkTemplate) &&
 			   (lhs.m_testSuites == rhs.m_testSuites);
 	}
 
@@ -1,45 +1,80 @@
 #pragma once
 
+#include "ClockType.h"
+#include "ExecutionCursor.h"
 #include "Format.h"
+#include "LinkTemplate.h"
+#include "ReportSerializer.h"
 #include "TestSuite.h"
 
+#include <deque>
+#include <memory_resource>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
+	// Test suites, and everything they contain, are allocated from a memory pool
+	// owned by the program: addresses are stable while the program runs, memory
+	// released by reported suites is reused, and everything is released in bulk
+	// when the program is destroyed. The pool is synchronized, as test threads
+	// add steps and tags concurrently. Because the pool is tied to the object,
+	// moving a program moves its suites one by one into the target pool.
 	class TestProgram
 	{
 	public:
 		TestProgram();
 		TestProgram(const TestProgram&);
+		// Not noexcept: suites are moved into this program's pool, which allocates
+		TestProgram(TestProgram&&);
 		virtual ~TestProgram() = default;
 
 		std::string getName() const;
 		std::string getOutputFolder() const;
 		std::string getTMSLinksPattern() const;
+		const LinkTemplate& getTMSLinkTemplate() const;
 		Format getFormat() const;
+		ClockType getClockType() const;
+		unsigned int getReportWorkersCount() const;
+		bool getIncrementalReports() const;
+		ReportSerializer getReportSerializer() const;
 
 		void setName(const std::string&);
 		void setOutputFolder(const std::string&);
 		void setTMSLinksPattern(const std::string&);
 		void setFormat(Format);
+		void setClockType(ClockType);
+		void setReportWorkersCount(unsigned int);
+		void setIncrementalReports(bool);
+		void setReportSerializer(ReportSerializer);
 
 		size_t getTestSuitesCount() const;
 		const TestSuite& getTestSuite(unsigned int index) const;
 		TestSuite& getTestSuite(unsigned int index);
+		TestSuite* getRunningTestSuite();
 		void addTestSuite(const TestSuite&);
+		void addTestSuite(TestSuite&&);
+		// Builds a running test suite in place, straight from the program arena
+		TestSuite& emplaceTestSuite(const std::string& uuid, const std::string& name, int64_t start);
 		void clearTestSuites();
 
 
 		virtual TestProgram& operator= (const TestProgram&);
+		virtual TestProgram& operator= (TestProgram&&);
 		friend bool operator== (const TestProgram& lhs, const TestProgram& rhs);
 		friend bool operator!= (const TestProgram& lhs, const TestProgram& rhs);
 
 	private:
 		std::string m_name;
 		std::string m_outputFolder;
-		std::string m_tmsLinksPattern;
-		std::vector<TestSuite> m_testSuites;
+		LinkTemplate m_tmsLinkTemplate;
+		std::pmr::synchronized_pool_resource m_arena;
+		std::pmr::deque<TestSuite> m_testSuites;
+		ExecutionCursor m_runningTestSuiteCursor;
 		Format m_format;
+		ClockType m_clockType;
+		unsigned int m_reportWorkersCount;
+		bool m_incrementalReports;
+		ReportSerializer m_reportSerializer;
 	};
 
 }}}
@@ -1,51 +1,101 @@
 #include "TestSuite.h"
 
+#include <utility>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
 	TestSuite::TestSuite()
-		:m_uuid()
-		,m_name()
-		,m_tmsId("")
+		:TestSuite(allocator_type())
+	{
+	}
+
+	TestSuite::TestSuite(const allocator_type& allocator)
+		:m_uuid(allocator)
+		,m_name(allocator)
+		,m_tmsId(allocator)
 		,m_status(Status::UNKNOWN)
 		,m_stage(Stage::PENDING)
 		,m_start(0)
 		,m_stop(0)
 		,m_format(Format::DEFAULT)
-		,m_labels()
-		,m_links()
-		,m_testCases()
+		,m_reported(false)
+		,m_labels(allocator)
+		,m_links(allocator)
+		,m_testCases(allocator)
+		,m_runningTestCaseCursor()
 	{
 	}
 
 	TestSuite::TestSuite(const TestSuite& other)
-		:m_uuid(other.m_uuid)
-		,m_name(other.m_name)
-		,m_tmsId(other.m_tmsId)
+		:TestSuite(other, allocator_type())
+	{
+	}
+
+	TestSuite::TestSuite(const TestSuite& other, const allocator_type& allocator)
+		:m_uuid(other.m_uuid, allocator)
+		,m_name(other.m_name, allocator)
+		,m_tmsId(other.m_tmsId, allocator)
+		,m_status(other.m_status)
+		,m_stage(other.m_stage)
+		,m_start(other.m_start)
+		,m_stop(other.m_stop)
+		,m_format(other.m_format)
+		,m_reported(other.m_reported)
+		,m_labels(other.m_labels, allocator)
+		,m_links(other.m_links, allocator)
+		,m_testCases(other.m_testCases, allocator)
+		,m_runningTestCaseCursor(other.m_runningTestCaseCursor)
+	{
+	}
+
+	TestSuite::TestSuite(TestSuite&& other)
+		:m_uuid(std::move(other.m_uuid))
+		,m_name(std::move(other.m_name))
+		,m_tmsId(std::move(other.m_tmsId))
 		,m_status(other.m_status)
 		,m_stage(other.m_stage)
 		,m_start(other.m_start)
 		,m_stop(other.m_stop)
 		,m_format(other.m_format)
-		,m_labels(other.m_labels)
-		,m_links(other.m_links)
-		,m_testCases(other.m_testCases)
+		,m_reported(other.m_reported)
+		,m_labels(std::move(other.m_labels))
+		,m_links(std::move(other.m_links))
+		,m_testCases(std::move(other.m_testCases))
+		,m_runningTestCaseCursor(other.m_runningTestCaseCursor)
+	{
+	}
+
+	TestSuite::TestSuite(TestSuite&& other, const allocator_type& allocator)
+		:m_uuid(std::move(other.m_uuid), allocator)
+		,m_name(std::move(other.m_name), allocator)
+		,m_tmsId(std::move(other.m_tmsId), allocator)
+		,m_status(other.m_status)
+		,m_stage(other.m_stage)
+		,m_start(other.m_start)
+		,m_stop(other.m_stop)
+		,m_format(other.m_format)
+		,m_reported(other.m_reported)
+		,m_labels(std::move(other.m_labels), allocator)
+		,m_links(std::move(other.m_links), allocator)
+		,m_testCases(std::move(other.m_testCases), allocator)
+		,m_runningTestCaseCursor(other.m_runningTestCaseCursor)
 	{
 	}
 
 	std::string TestSuite::getUUID() const
 	{
-		return m_uuid;
+		return std::string(m_uuid);
 	}
 
 	std::string TestSuite::getName() const
 	{
-		return m_name;
+		return std::string(m_name);
 	}
 
 	std::string TestSuite::getTmsId() const
 	{
-		return m_tmsId;
+		return std::string(m_tmsId);
 	}
 
 	Status TestSuite::getStatus() const
@@ -58,12 +108,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return m_stage;
 	}
 
-	time_t TestSuite::getStart() const
+	int64_t TestSuite::getStart() const
 	{
 		return m_start;
 	}
 
-	time_t TestSuite::getStop() const
+	int64_t TestSuite::getStop() const
 	{
 		return m_stop;
 	}
@@ -73,6 +123,11 @@ namespace systelab { namespace gtest_allure { namespace model {
 		return m_format;
 	}
 
+	bool TestSuite::isReported() const
+	{
+		return m_reported;
+	}
+
 	void TestSuite::setUUID(const std::string& uuid)
 	{
 		m_uuid = uuid;
@@ -98,12 +153,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_stage = stage;
 	}
 
-	void TestSuite::setStart(time_t start)
+	void TestSuite::setStart(int64_t start)
 	{
 		m_start = start;
 	}
 
-	void TestSuite::setStop(time_t stop)
+	void TestSuite::setStop(int64_t stop)
 	{
 		m_stop = stop;
 	}
@@ -113,7 +168,12 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_format = format;
 	}
 
-	const std::vector<Label>& TestSuite::getLabels() const
+	void TestSuite::setReported(bool reported)
+	{
+		m_reported = reported;
+	}
+
+	const std::pmr::vector<Label>& TestSuite::getLabels() const
 	{
 		return m_labels;
 	}
@@ -144,7 +204,20 @@ namespace systelab { namespace gtest_allure { namespace model {
 		}
 	}
 
-	const std::vector<Link>& TestSuite::getLinks() const
+	void TestSuite::addLabel(Label&& newLabel)
+	{
+		auto existingLabel = const_cast<Label*>(getLabel(newLabel.getName()));
+		if (existingLabel)
+		{
+			*existingLabel = std::move(newLabel);
+		}
+		else
+		{
+			m_labels.push_back(std::move(newLabel));
+		}
+	}
+
+	const std::pmr::vector<Link>& TestSuite::getLinks() const
 	{
 		return m_links;
 	}
@@ -154,24 +227,54 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_links.push_back(link);
 	}
 
-	std::vector<TestCase>& TestSuite::getTestCases()
+	void TestSuite::addLink(Link&& link)
+	{
+		m_links.push_back(std::move(link));
+	}
+
+	std::pmr::deque<TestCase>& TestSuite::getTestCases()
 	{
 		return m_testCases;
 	}
 
-	const std::vector<TestCase>& TestSuite::getTestCases() const
+	const std::pmr::deque<TestCase>& TestSuite::getTestCases() const
 	{
 		return m_testCases;
 	}
 
+	TestCase* TestSuite::getRunningTestCase()
+	{
+		return m_runningTestCaseCursor.getRunningItem(m_testCases);
+	}
+
 	void TestSuite::addTestCase(const TestCase& testCase)
 	{
 		m_testCases.push_back(testCase);
+		m_runningTestCaseCursor.onItemAdded(m_testCases);
+	}
+
+	void TestSuite::addTestCase(TestCase&& testCase)
+	{
+		m_testCases.push_back(std::move(testCase));
+		m_runningTestCaseCursor.onItemAdded(m_testCases);
+	}
+
+	TestCase& TestSuite::emplaceTestCase(const std::string& name, int64_t start)
+	{
+		TestCase& testCase = m_testCases.emplace_back();
+		testCase.setName(name);
+		testCase.setStart(start);
+		testCase.setStage(Stage::RUNNING);
+		testCase.setStatus(Status::UNKNOWN);
+
+		m_runningTestCaseCursor.onItemAdded(m_testCases);
+		return testCase;
 	}
 
 	void TestSuite::clearTestCases()
 	{
 		m_testCases.clear();
+		m_runningTestCaseCursor.reset();
 	}
 
 	TestSuite& TestSuite::operator= (const TestSuite& other)
@@ -183,10 +286,33 @@ namespace systelab { namespace gtest_allure { namespace model {
 		m_stage = other.m_stage;
 		m_start = other.m_start;
 		m_stop = other.m_stop;
+		m_format = other.m_format;
+		m_reported = other.m_reported;
 
 		m_labels = other.m_labels;
 		m_links = other.m_links;
 		m_testCases = other.m_testCases;
+		m_runningTestCaseCursor = other.m_runningTestCaseCursor;
+
+		return *this;
+	}
+
+	TestSuite& TestSuite::operator= (TestSuite&& other)
+	{
+		m_uuid = std::move(other.m_uuid);
+		m_name = std::move(other.m_name);
+		m_tmsId = std::move(other.m_tmsId);
+		m_status = other.m_status;
+		m_stage = other.m_stage;
+		m_start = other.m_start;
+		m_stop = other.m_stop;
+		m_format = other.m_format;
+		m_reported = other.m_reported;
+
+		m_labels = std::move(other.m_labels);
+		m_links = std::move(other.m_links);
+		m_testCases = std::move(other.m_testCases);
+		m_runningTestCaseCursor = other.m_runningTestCaseCursor;
 
 		return *this;
 	}
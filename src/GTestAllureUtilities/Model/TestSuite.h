@@ -4,17 +4,35 @@
 #include "Link.h"
 #include "Stage.h"
 #include "Status.h"
+#include "ExecutionCursor.h"
 #include "Format.h"
 #include "TestCase.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 
+	// Allocator-aware: when stored in a TestProgram, its strings, labels, links
+	// and test cases are allocated from the program arena.
 	class TestSuite
 	{
+	public:
+		using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
 	public:
 		TestSuite();
+		explicit TestSuite(const allocator_type&);
 		TestSuite(const TestSuite&);
+		TestSuite(const TestSuite&, const allocator_type&);
+		// Not noexcept: moving a deque allocates a new map for the moved-from one
+		TestSuite(TestSuite&&);
+		TestSuite(TestSuite&&, const allocator_type&);
 		virtual ~TestSuite() = default;
 
 		std::string getUUID() const;
@@ -22,48 +40,59 @@ namespace systelab { namespace gtest_allure { namespace model {
 		std::string getTmsId() const;
 		Status getStatus() const;
 		Stage getStage() const;
-		time_t getStart() const;
-		time_t getStop() const;
+		int64_t getStart() const;
+		int64_t getStop() const;
 		Format getFormat() const;
+		bool isReported() const;
 
 		void setUUID(const std::string&);
 		void setName(const std::string&);
 		void setTmsId(const std::string&);
 		void setStatus(Status);
 		void setStage(Stage);
-		void setStart(time_t);
-		void setStop(time_t);
+		void setStart(int64_t);
+		void setStop(int64_t);
 		void setFormat(Format);
+		void setReported(bool);
 
-		const std::vector<Label>& getLabels() const;
+		const std::pmr::vector<Label>& getLabels() const;
 		const Label* getLabel(const std::string& name) const;
 		void addLabel(const Label&);
+		void addLabel(Label&&);
 
-		const std::vector<Link>& getLinks() const;
+		const std::pmr::vector<Link>& getLinks() const;
 		void addLink(const Link&);
+		void addLink(Link&&);
 
-		std::vector<TestCase>& getTestCases();
-		const std::vector<TestCase>& getTestCases() const;
+		std::pmr::deque<TestCase>& getTestCases();
+		const std::pmr::deque<TestCase>& getTestCases() const;
+		TestCase* getRunningTestCase();
 		void addTestCase(const TestCase&);
+		void addTestCase(TestCase&&);
+		// Builds a running test case in place, straight with the suite allocator
+		TestCase& emplaceTestCase(const std::string& name, int64_t start);
 		void clearTestCases();
 
 		virtual TestSuite& operator= (const TestSuite&);
+		virtual TestSuite& operator= (TestSuite&&);
 		friend bool operator== (const TestSuite& lhs, const TestSuite& rhs);
 		friend bool operator!= (const TestSuite& lhs, const TestSuite& rhs);
 
 	private:
-		std::string m_uuid;
-		std::string m_name;
-		std::string m_tmsId;
+		std::pmr::string m_uuid;
+		std::pmr::string m_name;
+		std::pmr::string m_tmsId;
 		Status m_status;
 		Stage m_stage;
-		time_t m_start;
-		time_t m_stop;
+		int64_t m_start;
+		int64_t m_stop;
 		Format m_format;
+		bool m_reported;
 
-		std::vector<Label> m_labels;
-		std::vector<Link> m_links;
-		std::vector<TestCase> m_testCases;
+		std::pmr::vector<Label> m_labels;
+		std::pmr::vector<Link> m_links;
+		std::pmr::deque<TestCase> m_testCases;
+		ExecutionCursor m_runningTestCaseCursor;
 	};
 
 }}}
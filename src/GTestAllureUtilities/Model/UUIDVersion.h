@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace systelab { namespace gtest_allure { namespace model {
+
+	enum class UUIDVersion
+	{
+		V4 = 4,
+		V7 = 7
+	};
+
+}}}
@@ -1,9 +1,9 @@
 #include "JSONDocument.h"
 
+#include "JSONStringOutputStream.h"
 #include "JSONValue.h"
 
 #include <rapidjson/prettywriter.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
 
@@ -28,53 +28,56 @@ namespace systelab { namespace json { namespace rapidjson {
 		return *m_rootValue;
 	}
 
-	std::string JSONDocument::serialize(bool pretty) const
-	{
-		::rapidjson::StringBuffer jsonBuffer;
-		jsonBuffer.Clear();
+	namespace {
 
-		std::string serializedDocument;
-		if (pretty)
-		{
-			::rapidjson::PrettyWriter<::rapidjson::StringBuffer> jsonWriter(jsonBuffer);
-			jsonWriter.SetMaxDecimalPlaces(6);
-			m_document->Accept(jsonWriter);
-			serializedDocument = jsonBuffer.GetString();
-		}
-		else
+		typedef JSONStringOutputStream OutputStream;
+
+		void writeDocument(const ::rapidjson::Document& document, OutputStream& outputStream, bool pretty)
 		{
-			::rapidjson::Writer<::rapidjson::StringBuffer> jsonWriter(jsonBuffer);
-			jsonWriter.SetMaxDecimalPlaces(6);
-			m_document->Accept(jsonWriter);
-			serializedDocument = jsonBuffer.GetString();
+			if (pretty)
+			{
+				::rapidjson::PrettyWriter<OutputStream> jsonWriter(outputStream);
+				jsonWriter.SetMaxDecimalPlaces(6);
+				document.Accept(jsonWriter);
+			}
+			else
+			{
+				::rapidjson::Writer<OutputStream> jsonWriter(outputStream);
+				jsonWriter.SetMaxDecimalPlaces(6);
+				document.Accept(jsonWriter);
+			}
 		}
+	}
 
+	std::string JSONDocument::serialize(bool pretty) const
+	{
+		std::string serializedDocument;
+		serialize(serializedDocument, pretty);
 		return serializedDocument;
 	}
 
+	void JSONDocument::serialize(std::string& output, bool pretty) const
+	{
+		output.clear();
+		OutputStream outputStream(output);
+		writeDocument(*m_document, outputStream, pretty);
+	}
+
 	void JSONDocument::addFreeValue(std::unique_ptr<::rapidjson::Value> value)
 	{
-		m_freeValues.push_back(std::move(value));
+		const ::rapidjson::Value* key = value.get();
+		m_freeValues.emplace(key, std::move(value));
 	}
 
 	std::unique_ptr<::rapidjson::Value> JSONDocument::removeFreeValue(const ::rapidjson::Value& value)
 	{
 		std::unique_ptr<::rapidjson::Value> freeValueFound;
 
-		auto it = m_freeValues.begin();
-		while (!freeValueFound && (it != m_freeValues.end()))
+		auto it = m_freeValues.find(&value);
+		if (it != m_freeValues.end())
 		{
-			if (it->get() == &value)
-			{
-				std::unique_ptr<::rapidjson::Value> foundValue;
-				foundValue.swap(*it);
-				m_freeValues.erase(it);
-				freeValueFound = std::move(foundValue);
-			}
-			else
-			{
-				it++;
-			}
+			freeValueFound = std::move(it->second);
+			m_freeValues.erase(it);
 		}
 
 		return freeValueFound;
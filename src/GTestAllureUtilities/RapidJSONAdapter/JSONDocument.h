@@ -3,7 +3,7 @@
 #include "JSONAdapterInterface/IJSONDocument.h"
 
 #include <memory>
-#include <vector>
+#include <unordered_map>
 
 #include <rapidjson/document.h>
 
@@ -20,6 +20,7 @@ namespace systelab { namespace json { namespace rapidjson {
 		const IJSONValue& getRootValue() const override;
 
 		std::string serialize(bool pretty) const override;
+		void serialize(std::string& output, bool pretty) const override;
 
 	public:
 		void addFreeValue(std::unique_ptr<::rapidjson::Value>);
@@ -28,7 +29,8 @@ namespace systelab { namespace json { namespace rapidjson {
 	private:
 		std::unique_ptr<::rapidjson::Document> m_document;
 		std::unique_ptr<IJSONValue> m_rootValue;
-		std::vector< std::unique_ptr<::rapidjson::Value> > m_freeValues;
+		// Values built but not yet attached, keyed by address so that attaching is O(1)
+		std::unordered_map< const ::rapidjson::Value*, std::unique_ptr<::rapidjson::Value> > m_freeValues;
 	};
 
 }}}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+
+
+namespace systelab { namespace json { namespace rapidjson {
+
+	// rapidjson output stream appending to a caller-owned std::string
+	struct JSONStringOutputStream
+	{
+		typedef char Ch;
+
+		explicit JSONStringOutputStream(std::string& output)
+			:m_output(output)
+		{
+		}
+
+		void Put(char c)
+		{
+			m_output.push_back(c);
+		}
+
+		void Flush()
+		{
+		}
+
+		std::string& m_output;
+	};
+
+}}}
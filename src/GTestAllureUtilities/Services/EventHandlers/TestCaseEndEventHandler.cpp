@@ -16,20 +16,17 @@ namespace systelab { namespace gtest_allure { namespace service {
 	void TestCaseEndEventHandler::handleTestCaseEnd(model::Status status) const
 	{
 		model::TestCase& testCase = getRunningTestCase();
-		testCase.setStop(m_timeService->getCurrentTime());
+		testCase.setStop(m_timeService->getCurrentTimeMs());
 		testCase.setStage(model::Stage::FINISHED);
 		testCase.setStatus(status);
 	}
 
 	model::TestCase& TestCaseEndEventHandler::getRunningTestCase() const
 	{
-		auto& testSuite = getRunningTestSuite();
-		for (model::TestCase& testCase : testSuite.getTestCases())
+		model::TestCase* testCase = getRunningTestSuite().getRunningTestCase();
+		if (testCase)
 		{
-			if (testCase.getStage() == model::Stage::RUNNING)
-			{
-				return testCase;
-			}
+			return *testCase;
 		}
 
 		throw NoRunningTestCaseException();
@@ -37,14 +34,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	model::TestSuite& TestCaseEndEventHandler::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int) m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
@@ -6,7 +6,6 @@
 
 
 namespace systelab { namespace gtest_allure { namespace model {
-	class Action;
 	class TestCase;
 	class TestProgram;
 	class TestSuite;
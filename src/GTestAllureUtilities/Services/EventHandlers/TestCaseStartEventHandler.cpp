@@ -15,26 +15,16 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	void TestCaseStartEventHandler::handleTestCaseStart(const std::string& testCaseName) const
 	{
-		model::TestCase testCase;
-		testCase.setName(testCaseName);
-		testCase.setStart(m_timeService->getCurrentTime());
-		testCase.setStage(model::Stage::RUNNING);
-		testCase.setStatus(model::Status::UNKNOWN);
-
 		auto& testSuite = getRunningTestSuite();
-		testSuite.addTestCase(testCase);
+		testSuite.emplaceTestCase(testCaseName, m_timeService->getCurrentTimeMs());
 	}
 
 	model::TestSuite& TestCaseStartEventHandler::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int) m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
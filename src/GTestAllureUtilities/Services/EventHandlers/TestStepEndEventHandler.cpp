@@ -15,24 +15,24 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	void TestStepEndEventHandler::handleTestStepEnd(model::Status status) const
 	{
-		model::Step& step = getRunningTestStep();
-		step.setStop(m_timeService->getCurrentTime());
+		model::TestCase& testCase = getRunningTestCase();
+		model::Step& step = getRunningTestStep(testCase);
+		step.setStop(m_timeService->getCurrentTimeMs());
 		step.setStage(model::Stage::FINISHED);
 		step.setStatus(status);
+
+		// Steps are ended innermost first (see AllureAPI::StepScope), so the ones
+		// started after this one are already finished and nested into it
+		const auto& steps = testCase.getSteps();
+		step.setNestedStepsCount((unsigned int) (&steps.back() - &step));
 	}
 
-	model::Step& TestStepEndEventHandler::getRunningTestStep() const
+	model::Step& TestStepEndEventHandler::getRunningTestStep(model::TestCase& testCase) const
 	{
-		auto& testCase = getRunningTestCase();
-
-		unsigned int nSteps = testCase.getStepCount();
-		for (unsigned int i = 0; i < nSteps; i++)
+		model::Step* step = testCase.getRunningStep();
+		if (step)
 		{
-			auto step = testCase.getStep(i);
-			if (step->getStage() == model::Stage::RUNNING)
-			{
-				return *step;
-			}
+			return *step;
 		}
 
 		throw NoRunningTestStepException();
@@ -40,13 +40,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	model::TestCase& TestStepEndEventHandler::getRunningTestCase() const
 	{
-		auto& testSuite = getRunningTestSuite();
-		for (model::TestCase& testCase : testSuite.getTestCases())
+		model::TestCase* testCase = getRunningTestSuite().getRunningTestCase();
+		if (testCase)
 		{
-			if (testCase.getStage() == model::Stage::RUNNING)
-			{
-				return testCase;
-			}
+			return *testCase;
 		}
 
 		throw NoRunningTestCaseException();
@@ -54,14 +51,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	model::TestSuite& TestStepEndEventHandler::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int) m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
@@ -6,7 +6,6 @@
 
 
 namespace systelab { namespace gtest_allure { namespace model {
-	class Action;
 	class Step;
 	class TestCase;
 	class TestProgram;
@@ -27,7 +26,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 		void handleTestStepEnd(model::Status) const;
 
 	private:
-		model::Step& getRunningTestStep() const;
+		model::Step& getRunningTestStep(model::TestCase&) const;
 		model::TestCase& getRunningTestCase() const;
 		model::TestSuite& getRunningTestSuite() const;
 
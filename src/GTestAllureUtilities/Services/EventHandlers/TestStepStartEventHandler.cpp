@@ -1,7 +1,5 @@
 #include "TestStepStartEventHandler.h"
 
-#include "Model/Action.h"
-#include "Model/ExpectedResult.h"
 #include "Model/TestProgram.h"
 #include "Services/System/ITimeService.h"
 
@@ -17,37 +15,17 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	void TestStepStartEventHandler::handleTestStepStart(const std::string& testStepName, bool isAction) const
 	{
-		auto step = buildStep(isAction);
-		step->setName(testStepName);
-		step->setStart(m_timeService->getCurrentTime());
-		step->setStage(model::Stage::RUNNING);
-		step->setStatus(model::Status::UNKNOWN);
-
 		auto& testCase = getRunningTestCase();
-		testCase.addStep(std::move(step));
-	}
-
-	std::unique_ptr<model::Step> TestStepStartEventHandler::buildStep(bool isAction) const
-	{
-		if (isAction)
-		{
-			return std::make_unique<model::Action>();
-		}
-		else
-		{
-			return std::make_unique<model::ExpectedResult>();
-		}
+		testCase.emplaceStep(isAction ? model::StepType::ACTION_STEP : model::StepType::EXPECTED_RESULT_STEP,
+							 testStepName, m_timeService->getCurrentTimeMs());
 	}
 
 	model::TestCase& TestStepStartEventHandler::getRunningTestCase() const
 	{
-		auto& testSuite = getRunningTestSuite();
-		for (model::TestCase& testCase : testSuite.getTestCases())
+		model::TestCase* testCase = getRunningTestSuite().getRunningTestCase();
+		if (testCase)
 		{
-			if (testCase.getStage() == model::Stage::RUNNING)
-			{
-				return testCase;
-			}
+			return *testCase;
 		}
 
 		throw NoRunningTestCaseException();
@@ -55,14 +33,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	model::TestSuite& TestStepStartEventHandler::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int)m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
@@ -7,7 +7,6 @@
 
 
 namespace systelab { namespace gtest_allure { namespace model {
-	class Step;
 	class TestProgram;
 	class TestSuite;
 	class TestCase;
@@ -42,7 +41,6 @@ namespace systelab { namespace gtest_allure { namespace service {
 		};
 
 	private:
-		std::unique_ptr<model::Step> buildStep(bool isAction) const;
 		model::TestCase& getRunningTestCase() const;
 		model::TestSuite& getRunningTestSuite() const;
 
@@ -1,39 +1,46 @@
 #include "TestSuiteEndEventHandler.h"
 
+#include "AllureAPI.h"
+
 #include "Model/TestProgram.h"
+#include "Services/Report/ITestProgramJSONBuilder.h"
 #include "Services/System/ITimeService.h"
 
-#include <regex>
+#include <exception>
+#include <iostream>
 
 
 namespace systelab { namespace gtest_allure { namespace service {
 
 	TestSuiteEndEventHandler::TestSuiteEndEventHandler(model::TestProgram& testProgram,
-													   std::unique_ptr<ITimeService> timeService)
+													   std::unique_ptr<ITimeService> timeService,
+													   std::unique_ptr<ITestProgramJSONBuilder> testProgramJSONBuilder)
 		:m_testProgram(testProgram)
 		,m_timeService(std::move(timeService))
+		,m_testProgramJSONBuilder(std::move(testProgramJSONBuilder))
 	{
 	}
 
 	void TestSuiteEndEventHandler::handleTestSuiteEnd(model::Status status) const
 	{
 		model::TestSuite& testSuite = getRunningTestSuite();
-		testSuite.setStop(m_timeService->getCurrentTime());
+		testSuite.setStop(m_timeService->getCurrentTimeMs());
 		testSuite.setStage(model::Stage::FINISHED);
 		testSuite.setStatus(status);
 		addTMSLink(testSuite);
+
+		if (m_testProgram.getIncrementalReports() && gtest_allure::AllureAPI::getGenerateLegacyResults())
+		{
+			reportTestSuite(testSuite);
+		}
 	}
 
 	model::TestSuite& TestSuiteEndEventHandler::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int) m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
@@ -41,15 +48,42 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	void TestSuiteEndEventHandler::addTMSLink(model::TestSuite& testSuite) const
 	{
+		// Suite name given to setTestSuiteName, if any, as set into the suite by its property setter
 		auto tmsId = testSuite.getTmsId();
-		auto tmsLinksPattern = m_testProgram.getTMSLinksPattern();
-		auto tmsURL = tmsLinksPattern.replace(tmsLinksPattern.find("{}"), 2, tmsId);
+		auto testSuiteName = testSuite.getName();
 
 		model::Link tmsLink;
 		tmsLink.setName(tmsId);
-		tmsLink.setURL(tmsURL);
+		tmsLink.setURL(m_testProgram.getTMSLinkTemplate().render({ tmsId, testSuiteName }));
 		tmsLink.setType("tms");
-		testSuite.addLink(tmsLink);
+		testSuite.addLink(std::move(tmsLink));
+	}
+
+	void TestSuiteEndEventHandler::reportTestSuite(model::TestSuite& testSuite) const
+	{
+		// Errors are reported instead of escaping from the GoogleTest callback, which would abort
+		// the remaining tests: the suite is left unreported, so that it is saved again at program end
+		try
+		{
+			m_testProgramJSONBuilder->buildJSONFile(m_testProgram, testSuite);
+		}
+		catch (const std::exception& error)
+		{
+			std::cerr << "Allure report of test suite '" << testSuite.getName()
+					  << "' could not be saved, retrying at program end: " << error.what() << std::endl;
+			return;
+		}
+		catch (...)
+		{
+			std::cerr << "Allure report of test suite '" << testSuite.getName()
+					  << "' could not be saved, retrying at program end: unknown error" << std::endl;
+			return;
+		}
+
+		// Once saved, test cases are not needed anymore: only the suite header stays in memory,
+		// flagged so that it is not reported again at program end
+		testSuite.clearTestCases();
+		testSuite.setReported(true);
 	}
 
 }}}
@@ -12,6 +12,7 @@ namespace systelab { namespace gtest_allure { namespace model {
 
 namespace systelab { namespace gtest_allure { namespace service {
 
+	class ITestProgramJSONBuilder;
 	class ITimeService;
 	class IUUIDGeneratorService;
 
@@ -19,7 +20,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 	{
 	public:
 		TestSuiteEndEventHandler(model::TestProgram&,
-								 std::unique_ptr<ITimeService>);
+								 std::unique_ptr<ITimeService>,
+								 std::unique_ptr<ITestProgramJSONBuilder>);
 		virtual ~TestSuiteEndEventHandler() = default;
 
 		void handleTestSuiteEnd(model::Status) const override;
@@ -27,10 +29,12 @@ namespace systelab { namespace gtest_allure { namespace service {
 	private:
 		model::TestSuite& getRunningTestSuite() const;
 		void addTMSLink(model::TestSuite&) const;
+		void reportTestSuite(model::TestSuite&) const;
 
 	private:
 		model::TestProgram& m_testProgram;
 		std::unique_ptr<ITimeService> m_timeService;
+		std::unique_ptr<ITestProgramJSONBuilder> m_testProgramJSONBuilder;
 	};
 
 }}}
@@ -22,16 +22,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	void TestSuiteStartEventHandler::handleTestSuiteStart(const std::string& testSuiteName) const
 	{
-		model::TestSuite testSuite;
-		testSuite.setUUID(m_uuidGeneratorService->generateUUID());
+		model::TestSuite& testSuite = m_testProgram.emplaceTestSuite(m_uuidGeneratorService->generateUUID(),
+																	  testSuiteName, m_timeService->getCurrentTimeMs());
 		testSuite.setFormat(m_testProgram.getFormat());
-		testSuite.setName(testSuiteName);
 		testSuite.setTmsId(testSuiteName);
-		testSuite.setStart(m_timeService->getCurrentTime());
-		testSuite.setStage(model::Stage::RUNNING);
-		testSuite.setStatus(model::Status::UNKNOWN);
-
-		m_testProgram.addTestSuite(testSuite);
 	}
 
 }}}
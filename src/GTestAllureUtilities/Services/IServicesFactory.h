@@ -54,6 +54,13 @@ namespace systelab { namespace gtest_allure { namespace service {
 		virtual std::unique_ptr<IUUIDGeneratorService> buildUUIDGeneratorService() const = 0;
 		virtual std::unique_ptr<IFileService> buildFileService() const = 0;
 		virtual std::unique_ptr<ITimeService> buildTimeService() const = 0;
+
+		// Long-lived instances used by the AllureAPI on every call (never rebuilt per call)
+		virtual const IGTestStatusChecker& getGTestStatusChecker() const = 0;
+		virtual const ITestStepStartEventHandler& getTestStepStartEventHandler() const = 0;
+		virtual const ITestStepEndEventHandler& getTestStepEndEventHandler() const = 0;
+		virtual const ITestSuitePropertySetter& getTestSuitePropertySetter() const = 0;
+		virtual const ITestCasePropertySetter& getTestCasePropertySetter() const = 0;
 	};
 
 }}}
@@ -28,13 +28,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	model::TestCase& TestCasePropertySetter::getRunningTestCase() const
 	{
-		auto& testSuite = getRunningTestSuite();
-		for (model::TestCase& testCase : testSuite.getTestCases())
+		model::TestCase* testCase = getRunningTestSuite().getRunningTestCase();
+		if (testCase)
 		{
-			if (testCase.getStage() == model::Stage::RUNNING)
-			{
-				return testCase;
-			}
+			return *testCase;
 		}
 
 		throw NoRunningTestCaseException();
@@ -42,14 +39,10 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	model::TestSuite& TestCasePropertySetter::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int)m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
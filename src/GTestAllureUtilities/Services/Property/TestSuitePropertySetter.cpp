@@ -33,20 +33,16 @@ namespace systelab { namespace gtest_allure { namespace service {
 			model::Label label;
 			label.setName(name);
 			label.setValue(value);
-			testSuite.addLabel(label);
+			testSuite.addLabel(std::move(label));
 		}
 	}
 
 	model::TestSuite& TestSuitePropertySetter::getRunningTestSuite() const
 	{
-		unsigned int nTestSuites = (unsigned int) m_testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		model::TestSuite* testSuite = m_testProgram.getRunningTestSuite();
+		if (testSuite)
 		{
-			model::TestSuite& testSuite = m_testProgram.getTestSuite(i);
-			if (testSuite.getStage() == model::Stage::RUNNING)
-			{
-				return testSuite;
-			}
+			return *testSuite;
 		}
 
 		throw NoRunningTestSuiteException();
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "AllureAPI.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Immutable snapshot of a finished test, captured on the test thread so that
+	// it can be serialized and saved later on without touching AllureAPI state.
+	struct Allure2TestResult
+	{
+		std::string uuid;
+		std::string historyId;
+		std::string name;
+		std::string fullName;
+		std::string status;
+		std::string suiteName;
+
+		// AllureAPI settings (description, suite labels, TMS) in force when the test ended
+		std::shared_ptr<const AllureAPI::Configuration> configuration;
+
+		// Host, thread, framework and language labels, built once per thread (see
+		// Allure2TestResultJSONSerializer::buildEnvironmentLabels)
+		std::shared_ptr<const std::vector<AllureAPI::Label>> environmentLabels;
+
+		AllureAPI::TestCaseData data;
+
+		int64_t start = 0;
+		int64_t stop = 0;
+	};
+
+}}}
@@ -0,0 +1,227 @@
+#include "Allure2TestResultJSONSerializer.h"
+
+#include "Allure2TestResult.h"
+#include "Model/TestProperty.h"
+#include "RapidJSONAdapter/JSONStringOutputStream.h"
+
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	namespace {
+
+		using json::rapidjson::JSONStringOutputStream;
+		typedef rapidjson::Writer<JSONStringOutputStream> ResultWriter;
+
+		// Label names written for every result
+		const std::string SUITE_LABEL_NAME = "suite";
+		const std::string TAG_LABEL_NAME = "tag";
+
+		void writeString(ResultWriter& writer, const std::string& value)
+		{
+			writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+		}
+
+		void writeLabel(ResultWriter& writer, const std::string& name, const std::string& value)
+		{
+			writer.StartObject();
+			writer.Key("name");
+			writeString(writer, name);
+			writer.Key("value");
+			writeString(writer, value);
+			writer.EndObject();
+		}
+
+		void writeAttachments(ResultWriter& writer, const std::vector<AllureAPI::Attachment>& attachments)
+		{
+			writer.StartArray();
+			for (const auto& attachment : attachments)
+			{
+				writer.StartObject();
+				writer.Key("name");
+				writeString(writer, attachment.name);
+				writer.Key("source");
+				writeString(writer, attachment.source);
+				writer.Key("type");
+				writeString(writer, attachment.type);
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+
+		void writeParameters(ResultWriter& writer, const std::vector<AllureAPI::Parameter>& parameters)
+		{
+			writer.StartArray();
+			for (const auto& param : parameters)
+			{
+				writer.StartObject();
+				writer.Key("name");
+				writeString(writer, param.name);
+				writer.Key("value");
+				writeString(writer, param.value);
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+
+		void writeLabels(ResultWriter& writer, const Allure2TestResult& result,
+						 const AllureAPI::Configuration& configuration, const std::string& suiteName)
+		{
+			const auto& suiteLabels = configuration.suiteLabels;
+
+			writer.StartArray();
+			writeLabel(writer, SUITE_LABEL_NAME, suiteName);
+
+			for (const auto& [nameKey, value] : suiteLabels)
+			{
+				if (nameKey == model::test_property::NAME_PROPERTY)
+					continue;
+
+				writeLabel(writer, nameKey, value);
+			}
+
+			for (const auto& tag : result.data.tags)
+			{
+				writeLabel(writer, TAG_LABEL_NAME, tag);
+			}
+
+			for (const auto& label : result.data.labels)
+			{
+				if (!label.name.empty())
+					writeLabel(writer, label.name, label.value);
+			}
+
+			if (result.environmentLabels)
+			{
+				for (const auto& label : *result.environmentLabels)
+				{
+					writeLabel(writer, label.name, label.value);
+				}
+			}
+			writer.EndArray();
+		}
+
+		void writeLinks(ResultWriter& writer, const AllureAPI::Configuration& configuration, const std::string& suiteName)
+		{
+			writer.StartArray();
+			const auto& tmsId = configuration.tmsId;
+			if (!tmsId.empty())
+			{
+				writer.StartObject();
+				writer.Key("type");
+				writer.String("tms");
+				writer.Key("name");
+				writeString(writer, tmsId);
+
+				static thread_local std::string tmsLink;
+				tmsLink.clear();
+				configuration.tmsLinkTemplate.render({ tmsId, suiteName }, tmsLink);
+				if (!tmsLink.empty())
+				{
+					writer.Key("url");
+					writeString(writer, tmsLink);
+				}
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+
+		// Nested steps follow their parent step, which records how many of them there are
+		void writeSteps(ResultWriter& writer, const std::vector<AllureAPI::Step>& steps, size_t first, size_t last)
+		{
+			writer.StartArray();
+			for (size_t i = first; i < last; i += steps[i].nestedStepsCount + 1)
+			{
+				const auto& step = steps[i];
+				writer.StartObject();
+				writer.Key("name");
+				writeString(writer, step.name);
+				writer.Key("status");
+				writeString(writer, step.status);
+				writer.Key("stage");
+				writer.String("finished");
+				writer.Key("steps");
+				writeSteps(writer, steps, i + 1, std::min(last, i + 1 + step.nestedStepsCount));
+				writer.Key("start");
+				writer.Int64(step.startMs);
+				writer.Key("stop");
+				writer.Int64(step.stopMs);
+				writer.Key("parameters");
+				writeParameters(writer, step.parameters);
+				writer.Key("attachments");
+				writeAttachments(writer, step.attachments);
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+	}
+
+	Allure2TestResultJSONSerializer::Allure2TestResultJSONSerializer()
+	{
+	}
+
+	std::string Allure2TestResultJSONSerializer::serialize(const Allure2TestResult& result) const
+	{
+		std::string output;
+		serialize(result, output);
+		return output;
+	}
+
+	std::vector<AllureAPI::Label> Allure2TestResultJSONSerializer::buildEnvironmentLabels(const std::string& host, const std::string& thread)
+	{
+		return {
+			{ "host", host },
+			{ "thread", thread },
+			{ "framework", "gtest" },
+			{ "language", "cpp" }
+		};
+	}
+
+	void Allure2TestResultJSONSerializer::serialize(const Allure2TestResult& result, std::string& output) const
+	{
+		static const AllureAPI::Configuration defaultConfiguration;
+		const auto& configuration = result.configuration ? *result.configuration : defaultConfiguration;
+		const auto& suiteName = configuration.getSuiteName(result.suiteName);
+
+		output.clear();
+		JSONStringOutputStream stream(output);
+		ResultWriter writer(stream);
+
+		writer.StartObject();
+		writer.Key("uuid");
+		writeString(writer, result.uuid);
+		writer.Key("historyId");
+		writeString(writer, result.historyId);
+		writer.Key("name");
+		writeString(writer, result.name);
+		writer.Key("testCaseName");
+		writeString(writer, result.name);
+		writer.Key("fullName");
+		writeString(writer, result.fullName);
+		writer.Key("status");
+		writeString(writer, result.status);
+		writer.Key("stage");
+		writer.String("finished");
+		writer.Key("description");
+		writeString(writer, configuration.description);
+		writer.Key("labels");
+		writeLabels(writer, result, configuration, suiteName);
+		writer.Key("links");
+		writeLinks(writer, configuration, suiteName);
+		writer.Key("steps");
+		writeSteps(writer, result.data.steps, 0, result.data.steps.size());
+		writer.Key("attachments");
+		writeAttachments(writer, result.data.attachments);
+		writer.Key("parameters");
+		writeParameters(writer, result.data.parameters);
+		writer.Key("start");
+		writer.Int64(result.start);
+		writer.Key("stop");
+		writer.Int64(result.stop);
+		writer.EndObject();
+	}
+
+}}}
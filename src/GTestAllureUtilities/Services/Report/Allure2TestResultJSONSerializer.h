@@ -0,0 +1,26 @@
+#pragma once
+
+#include "IAllure2TestResultJSONSerializer.h"
+
+#include "AllureAPI.h"
+
+#include <string>
+#include <vector>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	class Allure2TestResultJSONSerializer : public IAllure2TestResultJSONSerializer
+	{
+	public:
+		Allure2TestResultJSONSerializer();
+		virtual ~Allure2TestResultJSONSerializer() = default;
+
+		std::string serialize(const Allure2TestResult&) const override;
+		void serialize(const Allure2TestResult&, std::string& output) const override;
+
+		// Builds the host, thread, framework and language labels, which do not change along a thread
+		static std::vector<AllureAPI::Label> buildEnvironmentLabels(const std::string& host, const std::string& thread);
+	};
+
+}}}
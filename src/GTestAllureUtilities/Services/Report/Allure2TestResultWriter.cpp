@@ -0,0 +1,167 @@
+#include "Allure2TestResultWriter.h"
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	Allure2TestResultWriter::Allure2TestResultWriter(std::unique_ptr<IAllure2TestResultJSONSerializer> serializer)
+		:m_serializer(std::move(serializer))
+		,m_outputFolder(std::make_shared<const OutputFolder>())
+		,m_queueCapacity(0)
+		,m_backPressurePolicy(model::BackPressurePolicy::BLOCK)
+		,m_running(false)
+		,m_stopping(false)
+	{
+	}
+
+	Allure2TestResultWriter::~Allure2TestResultWriter()
+	{
+		try
+		{
+			flush();
+		}
+		catch (...)
+		{
+		}
+	}
+
+	void Allure2TestResultWriter::setOutputFolder(const std::string& folderPath)
+	{
+		if (getOutputFolder()->getPath() == folderPath)
+		{
+			return;
+		}
+
+		// Queued results keep the previous folder alive until they are saved
+		auto outputFolder = std::make_shared<OutputFolder>();
+		outputFolder->open(folderPath);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_outputFolder = std::move(outputFolder);
+	}
+
+	void Allure2TestResultWriter::start(size_t queueCapacity, model::BackPressurePolicy backPressurePolicy)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_running || (queueCapacity == 0))
+		{
+			return;
+		}
+
+		m_queueCapacity = queueCapacity;
+		m_backPressurePolicy = backPressurePolicy;
+		m_stopping = false;
+		m_running = true;
+		m_thread = std::thread(&Allure2TestResultWriter::run, this);
+	}
+
+	void Allure2TestResultWriter::write(Allure2TestResult&& result)
+	{
+		std::shared_ptr<const OutputFolder> outputFolder;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			outputFolder = m_outputFolder;
+			if (m_running)
+			{
+				bool queueFull = (m_queue.size() >= m_queueCapacity);
+				if (!queueFull || (m_backPressurePolicy == model::BackPressurePolicy::BLOCK))
+				{
+					m_queueNotFull.wait(lock, [this]() { return !m_running || (m_queue.size() < m_queueCapacity); });
+					if (m_running)
+					{
+						m_queue.emplace_back(std::move(result), std::move(outputFolder));
+						m_queueNotEmpty.notify_one();
+						return;
+					}
+				}
+			}
+		}
+
+		save(result, *outputFolder);
+	}
+
+	void Allure2TestResultWriter::flush()
+	{
+		std::thread writerThread;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopping = true;
+			writerThread = std::move(m_thread);
+		}
+
+		m_queueNotEmpty.notify_all();
+		if (writerThread.joinable())
+		{
+			writerThread.join();
+		}
+
+		std::exception_ptr error;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopping = false;
+			error = std::move(m_error);
+			m_error = nullptr;
+		}
+
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+	bool Allure2TestResultWriter::isAsync() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_running;
+	}
+
+	void Allure2TestResultWriter::run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_queueNotEmpty.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+			if (m_queue.empty())
+			{
+				break;
+			}
+
+			PendingResult pendingResult = std::move(m_queue.front());
+			m_queue.pop_front();
+			m_queueNotFull.notify_one();
+
+			lock.unlock();
+			try
+			{
+				save(pendingResult.first, *pendingResult.second);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> errorLock(m_mutex);
+				if (!m_error)
+				{
+					m_error = std::current_exception();
+				}
+			}
+			lock.lock();
+		}
+
+		m_running = false;
+		m_queueNotFull.notify_all();
+	}
+
+	std::shared_ptr<const OutputFolder> Allure2TestResultWriter::getOutputFolder() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_outputFolder;
+	}
+
+	void Allure2TestResultWriter::save(const Allure2TestResult& result, const OutputFolder& outputFolder) const
+	{
+		// Reused across results written by the same thread, so its capacity is only grown once
+		static thread_local std::string content;
+		m_serializer->serialize(result, content);
+
+		outputFolder.saveFile(result.uuid + "-result.json", content.data(), content.size());
+	}
+
+}}}
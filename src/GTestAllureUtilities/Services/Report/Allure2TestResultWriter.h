@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Allure2TestResult.h"
+#include "IAllure2TestResultJSONSerializer.h"
+
+#include "Model/BackPressurePolicy.h"
+#include "Services/System/OutputFolder.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Saves Allure2 result files either synchronously on the calling thread or,
+	// once started, through a bounded queue drained by a dedicated writer thread.
+	class Allure2TestResultWriter
+	{
+	public:
+		explicit Allure2TestResultWriter(std::unique_ptr<IAllure2TestResultJSONSerializer>);
+		virtual ~Allure2TestResultWriter();
+
+		// Opens the given folder unless already open. Results written before keep
+		// being saved into the folder in force when they were written.
+		void setOutputFolder(const std::string& folderPath);
+
+		void start(size_t queueCapacity, model::BackPressurePolicy);
+		void write(Allure2TestResult&&);
+		void flush();
+
+		bool isAsync() const;
+
+	private:
+		using PendingResult = std::pair<Allure2TestResult, std::shared_ptr<const OutputFolder>>;
+
+		void run();
+		// Serializes and saves the result file (called by the writer thread when async)
+		void save(const Allure2TestResult&, const OutputFolder&) const;
+		std::shared_ptr<const OutputFolder> getOutputFolder() const;
+
+	private:
+		std::unique_ptr<IAllure2TestResultJSONSerializer> m_serializer;
+		std::shared_ptr<const OutputFolder> m_outputFolder;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_queueNotEmpty;
+		std::condition_variable m_queueNotFull;
+		std::deque<PendingResult> m_queue;
+		size_t m_queueCapacity;
+		model::BackPressurePolicy m_backPressurePolicy;
+
+		std::thread m_thread;
+		bool m_running;
+		bool m_stopping;
+		std::exception_ptr m_error;
+	};
+
+}}}
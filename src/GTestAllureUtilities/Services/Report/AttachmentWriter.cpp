@@ -0,0 +1,198 @@
+#include "AttachmentWriter.h"
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	AttachmentWriter::AttachmentWriter()
+		:m_outputFolder()
+		,m_outputFolderPath()
+		,m_savedOnceFileNames()
+		,m_pendingBytes(0)
+		,m_pendingBytesCapacity(DEFAULT_PENDING_BYTES_CAPACITY)
+		,m_running(false)
+		,m_stopping(false)
+	{
+	}
+
+	AttachmentWriter::~AttachmentWriter()
+	{
+		try
+		{
+			flush();
+		}
+		catch (...)
+		{
+		}
+	}
+
+	void AttachmentWriter::setOutputFolder(const std::string& folderPath)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (folderPath != m_outputFolderPath)
+		{
+			m_outputFolderPath = folderPath;
+			m_savedOnceFileNames.clear();
+		}
+	}
+
+	void AttachmentWriter::setPendingBytesCapacity(size_t capacity)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pendingBytesCapacity = capacity;
+		}
+
+		m_pendingBytesReleased.notify_all();
+	}
+
+	size_t AttachmentWriter::getPendingBytesCapacity() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_pendingBytesCapacity;
+	}
+
+	size_t AttachmentWriter::getPendingBytes() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_pendingBytes;
+	}
+
+	void AttachmentWriter::save(const std::string& fileName, std::string&& content)
+	{
+		write(fileName, std::move(content), false);
+	}
+
+	void AttachmentWriter::append(const std::string& fileName, std::string&& content)
+	{
+		write(fileName, std::move(content), true);
+	}
+
+	bool AttachmentWriter::saveOnce(const std::string& fileName, std::string_view content)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_savedOnceFileNames.insert(fileName).second)
+			{
+				return false;
+			}
+		}
+
+		write(fileName, std::string(content), false, true);
+		return true;
+	}
+
+	void AttachmentWriter::flush()
+	{
+		std::thread writerThread;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopping = true;
+			writerThread = std::move(m_thread);
+		}
+
+		m_queueNotEmpty.notify_all();
+		if (writerThread.joinable())
+		{
+			writerThread.join();
+		}
+
+		std::exception_ptr error;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopping = false;
+			error = std::move(m_error);
+			m_error = nullptr;
+		}
+
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+	void AttachmentWriter::write(const std::string& fileName, std::string&& content, bool append, bool savedOnce)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (!m_running)
+		{
+			m_stopping = false;
+			m_running = true;
+			m_thread = std::thread(&AttachmentWriter::run, this);
+		}
+
+		size_t size = content.size();
+		m_pendingBytesReleased.wait(lock, [this, size]()
+		{
+			return (m_pendingBytes == 0) || (m_pendingBytes + size <= m_pendingBytesCapacity);
+		});
+
+		m_pendingBytes += size;
+		m_queue.push_back({ m_outputFolderPath, fileName, std::move(content), append, savedOnce });
+		m_queueNotEmpty.notify_one();
+	}
+
+	void AttachmentWriter::run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_queueNotEmpty.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+			if (m_queue.empty())
+			{
+				break;
+			}
+
+			// Bytes stay pending until saved, as the content is held in memory meanwhile
+			PendingFile pendingFile = std::move(m_queue.front());
+			m_queue.pop_front();
+
+			lock.unlock();
+			try
+			{
+				openOutputFolder(pendingFile.folderPath);
+				if (pendingFile.append)
+				{
+					m_outputFolder.appendFile(pendingFile.fileName, pendingFile.content.data(), pendingFile.content.size());
+				}
+				else
+				{
+					m_outputFolder.saveFile(pendingFile.fileName, pendingFile.content.data(), pendingFile.content.size());
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> errorLock(m_mutex);
+				if (!m_error)
+				{
+					m_error = std::current_exception();
+				}
+
+				// Names saved into a previous output folder are already forgotten
+				if (pendingFile.savedOnce && (pendingFile.folderPath == m_outputFolderPath))
+				{
+					m_savedOnceFileNames.erase(pendingFile.fileName);
+				}
+			}
+			lock.lock();
+
+			m_pendingBytes -= pendingFile.content.size();
+			m_pendingBytesReleased.notify_all();
+		}
+
+		// Reopened by the next writer thread, in case the folder was removed meanwhile
+		m_outputFolder.close();
+		m_running = false;
+	}
+
+	void AttachmentWriter::openOutputFolder(const std::string& folderPath)
+	{
+		// Only used by the writer thread, so no lock is needed
+		if (m_outputFolder.isOpen() && (m_outputFolder.getPath() == folderPath))
+		{
+			return;
+		}
+
+		m_outputFolder.open(folderPath);
+	}
+
+}}}
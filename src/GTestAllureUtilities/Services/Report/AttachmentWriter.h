@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Services/System/OutputFolder.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Saves attachment files into the output folder from a dedicated writer thread,
+	// started on the first write. Content waiting to be saved is bounded by a byte
+	// capacity: writers block until enough pending bytes have been saved (content
+	// larger than the capacity is accepted once nothing else is pending).
+	class AttachmentWriter
+	{
+	public:
+		static constexpr size_t DEFAULT_PENDING_BYTES_CAPACITY = 16 * 1024 * 1024;
+
+	public:
+		AttachmentWriter();
+		virtual ~AttachmentWriter();
+
+		// Files are saved into the folder set when they were written, which the writer thread opens
+		void setOutputFolder(const std::string& folderPath);
+		void setPendingBytesCapacity(size_t capacity);
+		size_t getPendingBytesCapacity() const;
+		size_t getPendingBytes() const;
+
+		// Files are saved in write order, so appended content follows the content saved before
+		void save(const std::string& fileName, std::string&& content);
+		void append(const std::string& fileName, std::string&& content);
+
+		// Saves a content-addressed file unless it was already saved into the current
+		// output folder: the content is only copied when saved. Returns whether saved.
+		// A file that fails to be saved is forgotten, so that it is saved again next time.
+		bool saveOnce(const std::string& fileName, std::string_view content);
+
+		// Waits until all pending files are saved and rethrows the first error found
+		void flush();
+
+	private:
+		struct PendingFile
+		{
+			std::string folderPath;
+			std::string fileName;
+			std::string content;
+			bool append;
+			bool savedOnce;
+		};
+
+		void write(const std::string& fileName, std::string&& content, bool append, bool savedOnce = false);
+		void run();
+		void openOutputFolder(const std::string& folderPath);
+
+	private:
+		OutputFolder m_outputFolder;
+		std::string m_outputFolderPath;
+		std::unordered_set<std::string> m_savedOnceFileNames;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_queueNotEmpty;
+		std::condition_variable m_pendingBytesReleased;
+		std::deque<PendingFile> m_queue;
+		size_t m_pendingBytes;
+		size_t m_pendingBytesCapacity;
+
+		std::thread m_thread;
+		bool m_running;
+		bool m_stopping;
+		std::exception_ptr m_error;
+	};
+
+}}}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	struct Allure2TestResult;
+
+	class IAllure2TestResultJSONSerializer
+	{
+	public:
+		virtual ~IAllure2TestResultJSONSerializer() = default;
+
+		virtual std::string serialize(const Allure2TestResult&) const = 0;
+		// Streams the result straight into the given buffer (cleared first, capacity kept)
+		virtual void serialize(const Allure2TestResult&, std::string& output) const = 0;
+	};
+
+}}}
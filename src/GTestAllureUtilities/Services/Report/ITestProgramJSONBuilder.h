@@ -4,6 +4,7 @@
 
 namespace systelab { namespace gtest_allure { namespace model {
 	class TestProgram;
+	class TestSuite;
 }}}
 
 namespace systelab { namespace gtest_allure { namespace service {
@@ -13,7 +14,9 @@ namespace systelab { namespace gtest_allure { namespace service {
 	public:
 		virtual ~ITestProgramJSONBuilder() = default;
 
+		// Suites already reported (see TestSuite::isReported) are skipped
 		virtual void buildJSONFiles(const model::TestProgram&) const = 0;
+		virtual void buildJSONFile(const model::TestProgram&, const model::TestSuite&) const = 0;
 	};
 
 }}}
@@ -14,6 +14,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 		virtual ~ITestSuiteJSONSerializer() = default;
 
 		virtual std::string serialize(const model::TestSuite&) const = 0;
+		// Serializes into the given buffer (contents replaced, capacity kept for the next suite)
+		virtual void serialize(const model::TestSuite&, std::string& output) const = 0;
 	};
 
 }}}
@@ -4,27 +4,150 @@
 #include "Services/Report/ITestSuiteJSONSerializer.h"
 #include "Services/System/IFileService.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
 
 namespace systelab { namespace gtest_allure { namespace service {
 
 	TestProgramJSONBuilder::TestProgramJSONBuilder(std::unique_ptr<ITestSuiteJSONSerializer> testSuiteJSONSerializer,
 												   std::unique_ptr<IFileService> fileService)
 		:m_testSuiteJSONSerializer(std::move(testSuiteJSONSerializer))
+		,m_testSuiteJSONSerializerFactory()
+		,m_fileService(std::move(fileService))
+	{
+	}
+
+	TestProgramJSONBuilder::TestProgramJSONBuilder(TestSuiteJSONSerializerFactory testSuiteJSONSerializerFactory,
+												   std::unique_ptr<IFileService> fileService)
+		:m_testSuiteJSONSerializer()
+		,m_testSuiteJSONSerializerFactory(std::move(testSuiteJSONSerializerFactory))
 		,m_fileService(std::move(fileService))
 	{
 	}
 
 	void TestProgramJSONBuilder::buildJSONFiles(const model::TestProgram& testProgram) const
 	{
-		std::string testProgramName = testProgram.getName();
-		unsigned int nTestSuites = (unsigned int) testProgram.getTestSuitesCount();
-		for (unsigned int i = 0; i < nTestSuites; i++)
+		size_t nTestSuites = testProgram.getTestSuitesCount();
+		size_t nWorkers = std::min(getWorkersCount(testProgram), nTestSuites);
+		if (nWorkers <= 1)
+		{
+			std::unique_ptr<ITestSuiteJSONSerializer> builtTestSuiteJSONSerializer;
+			const ITestSuiteJSONSerializer* testSuiteJSONSerializer = m_testSuiteJSONSerializer.get();
+
+			std::string testSuiteJSONBuffer;
+			for (unsigned int i = 0; i < nTestSuites; i++)
+			{
+				const model::TestSuite& testSuite = testProgram.getTestSuite(i);
+				if (!testSuite.isReported())
+				{
+					if (!testSuiteJSONSerializer)
+					{
+						builtTestSuiteJSONSerializer = buildTestSuiteJSONSerializer(testProgram);
+						testSuiteJSONSerializer = builtTestSuiteJSONSerializer.get();
+					}
+
+					buildJSONFile(testProgram, testSuite, *testSuiteJSONSerializer, testSuiteJSONBuffer);
+				}
+			}
+
+			return;
+		}
+
+		// Suites are handed out one at a time, so a worker busy with a large suite does not hold
+		// back the rest. Output does not depend on scheduling: each suite goes to its own file.
+		// Serializers are only built by the workers actually started.
+		std::atomic<size_t> nextTestSuite(0);
+		std::vector<std::exception_ptr> workerErrors(nWorkers);
+		auto runWorker = [&](size_t workerIndex)
+		{
+			try
+			{
+				auto testSuiteJSONSerializer = buildTestSuiteJSONSerializer(testProgram);
+				std::string testSuiteJSONBuffer;
+				for (size_t i = nextTestSuite++; i < nTestSuites; i = nextTestSuite++)
+				{
+					const model::TestSuite& testSuite = testProgram.getTestSuite((unsigned int) i);
+					if (!testSuite.isReported())
+					{
+						buildJSONFile(testProgram, testSuite, *testSuiteJSONSerializer, testSuiteJSONBuffer);
+					}
+				}
+			}
+			catch (...)
+			{
+				workerErrors[workerIndex] = std::current_exception();
+				nextTestSuite = nTestSuites;
+			}
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve(nWorkers - 1);
+		for (size_t workerIndex = 1; workerIndex < nWorkers; workerIndex++)
+		{
+			workers.emplace_back(runWorker, workerIndex);
+		}
+
+		runWorker(0);
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+
+		for (const auto& workerError : workerErrors)
+		{
+			if (workerError)
+			{
+				std::rethrow_exception(workerError);
+			}
+		}
+	}
+
+	void TestProgramJSONBuilder::buildJSONFile(const model::TestProgram& testProgram, const model::TestSuite& testSuite) const
+	{
+		std::string testSuiteJSONBuffer;
+		if (m_testSuiteJSONSerializer)
+		{
+			buildJSONFile(testProgram, testSuite, *m_testSuiteJSONSerializer, testSuiteJSONBuffer);
+		}
+		else
+		{
+			buildJSONFile(testProgram, testSuite, *buildTestSuiteJSONSerializer(testProgram), testSuiteJSONBuffer);
+		}
+	}
+
+	size_t TestProgramJSONBuilder::getWorkersCount(const model::TestProgram& testProgram) const
+	{
+		if (m_testSuiteJSONSerializer)
 		{
-			const model::TestSuite& testSuite = testProgram.getTestSuite(i);
-			std::string testCaseJSONFilepath = testProgram.getOutputFolder() + "\\" + testSuite.getUUID() + "-" + testProgramName + ".json";
-			std::string testCaseJSONContent = m_testSuiteJSONSerializer->serialize(testSuite);
-			m_fileService->saveFile(testCaseJSONFilepath, testCaseJSONContent);
+			return 1;
 		}
+
+		unsigned int nWorkers = testProgram.getReportWorkersCount();
+		if (nWorkers == 0)
+		{
+			nWorkers = std::max(std::thread::hardware_concurrency(), 1U);
+		}
+
+		return nWorkers;
+	}
+
+	std::unique_ptr<ITestSuiteJSONSerializer> TestProgramJSONBuilder::buildTestSuiteJSONSerializer(const model::TestProgram& testProgram) const
+	{
+		return m_testSuiteJSONSerializerFactory(testProgram);
+	}
+
+	void TestProgramJSONBuilder::buildJSONFile(const model::TestProgram& testProgram,
+											   const model::TestSuite& testSuite,
+											   const ITestSuiteJSONSerializer& testSuiteJSONSerializer,
+											   std::string& buffer) const
+	{
+		std::string testCaseJSONFilepath = testProgram.getOutputFolder() + "\\" + testSuite.getUUID() + "-" + testProgram.getName() + ".json";
+		testSuiteJSONSerializer.serialize(testSuite, buffer);
+		m_fileService->saveFile(testCaseJSONFilepath, buffer);
 	}
 
 }}}
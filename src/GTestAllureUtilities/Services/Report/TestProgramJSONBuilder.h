@@ -2,9 +2,15 @@
 
 #include "ITestProgramJSONBuilder.h"
 
+#include <functional>
 #include <memory>
+#include <string>
 
 
+namespace systelab { namespace gtest_allure { namespace model {
+	class TestSuite;
+}}}
+
 namespace systelab { namespace gtest_allure { namespace service {
 
 	class IFileService;
@@ -12,15 +18,29 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	class TestProgramJSONBuilder : public ITestProgramJSONBuilder
 	{
+	public:
+		typedef std::function< std::unique_ptr<ITestSuiteJSONSerializer>(const model::TestProgram&) > TestSuiteJSONSerializerFactory;
+
 	public:
 		TestProgramJSONBuilder(std::unique_ptr<ITestSuiteJSONSerializer>,
 							   std::unique_ptr<IFileService>);
+		// Parallel mode: the number of workers is read from the test program when building the files,
+		// and each worker serializes and saves suites with its own serializer built by the factory
+		TestProgramJSONBuilder(TestSuiteJSONSerializerFactory,
+							   std::unique_ptr<IFileService>);
 		virtual ~TestProgramJSONBuilder() = default;
 
 		virtual void buildJSONFiles(const model::TestProgram&) const;
+		virtual void buildJSONFile(const model::TestProgram&, const model::TestSuite&) const;
+
+	private:
+		size_t getWorkersCount(const model::TestProgram&) const;
+		std::unique_ptr<ITestSuiteJSONSerializer> buildTestSuiteJSONSerializer(const model::TestProgram&) const;
+		void buildJSONFile(const model::TestProgram&, const model::TestSuite&, const ITestSuiteJSONSerializer&, std::string& buffer) const;
 
 	private:
 		std::unique_ptr<ITestSuiteJSONSerializer> m_testSuiteJSONSerializer;
+		TestSuiteJSONSerializerFactory m_testSuiteJSONSerializerFactory;
 		std::unique_ptr<IFileService> m_fileService;
 	};
 
@@ -7,6 +7,8 @@
 #include "JSONAdapterInterface/IJSONDocument.h"
 #include "JSONAdapterInterface/IJSONValue.h"
 
+#include <algorithm>
+
 
 namespace systelab { namespace gtest_allure { namespace service {
 
@@ -16,6 +18,16 @@ namespace systelab { namespace gtest_allure { namespace service {
 	}
 
 	std::string TestSuiteJSONSerializer::serialize(const model::TestSuite& testSuite) const
+	{
+		return buildDocument(testSuite)->serialize();
+	}
+
+	void TestSuiteJSONSerializer::serialize(const model::TestSuite& testSuite, std::string& output) const
+	{
+		buildDocument(testSuite)->serialize(output);
+	}
+
+	std::unique_ptr<json::IJSONDocument> TestSuiteJSONSerializer::buildDocument(const model::TestSuite& testSuite) const
 	{
 		auto jsonDocument = m_jsonAdapter->buildEmptyDocument();
 		auto& jsonDocumentRoot = jsonDocument->getRootValue();
@@ -23,7 +35,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 		addTestSuiteToJSON(testSuite, jsonDocumentRoot);
 
-		return jsonDocument->serialize();
+		return jsonDocument;
 	}
 
 	void TestSuiteJSONSerializer::addTestSuiteToJSON(const model::TestSuite& testSuite, json::IJSONValue& jsonParent) const
@@ -51,7 +63,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 		jsonSuiteLabel->addMember("value", testSuite.getName());
 		jsonLabelsArray->addArrayValue(std::move(jsonSuiteLabel));
 
-		const std::vector<model::Label>& labels = testSuite.getLabels();
+		const std::pmr::vector<model::Label>& labels = testSuite.getLabels();
 		if (labels.size() > 0)
 		{
 			for (const auto& label : labels)
@@ -66,7 +78,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 		jsonParent.addMember("labels", std::move(jsonLabelsArray));
 	}
 
-	void TestSuiteJSONSerializer::addLinksToJSON(const std::vector<model::Link>& links, json::IJSONValue& jsonParent) const
+	void TestSuiteJSONSerializer::addLinksToJSON(const std::pmr::vector<model::Link>& links, json::IJSONValue& jsonParent) const
 	{
 		if (links.size() > 0)
 		{
@@ -84,7 +96,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 		}
 	}
 
-	void TestSuiteJSONSerializer::addTestCasesToJSON(const std::vector<model::TestCase>& testCases, json::IJSONValue& jsonParent) const
+	void TestSuiteJSONSerializer::addTestCasesToJSON(const std::pmr::deque<model::TestCase>& testCases, json::IJSONValue& jsonParent) const
 	{
 		if (testCases.size() > 0)
 		{
@@ -98,7 +110,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 				jsonTestCase->addMember("start", testCase.getStart());
 				jsonTestCase->addMember("stop", testCase.getStop());
 
-				addTestCaseStepsToJSON(testCase, *jsonTestCase);
+				const auto& steps = testCase.getSteps();
+				addStepsToJSON(steps, 0, steps.size(), *jsonTestCase);
 
 				jsonTestCasesArray->addArrayValue(std::move(jsonTestCase));
 			}
@@ -107,23 +120,26 @@ namespace systelab { namespace gtest_allure { namespace service {
 		}
 	}
 
-	void TestSuiteJSONSerializer::addTestCaseStepsToJSON(const model::TestCase& testCase, json::IJSONValue& jsonParent) const
+	void TestSuiteJSONSerializer::addStepsToJSON(const std::pmr::vector<model::Step>& steps, size_t first, size_t last,
+												 json::IJSONValue& jsonParent) const
 	{
-		unsigned int nSteps = testCase.getStepCount();
-		if (nSteps > 0)
+		if (first < last)
 		{
 			auto jsonStepsArray = jsonParent.buildValue(json::ARRAY_TYPE);
-			for (unsigned int i = 0; i < nSteps; i++)
+			for (size_t i = first; i < last; i += steps[i].getNestedStepsCount() + 1)
 			{
-				auto step = testCase.getStep(i);
+				const model::Step& step = steps[i];
 				auto jsonStep = jsonStepsArray->buildValue(json::OBJECT_TYPE);
-				auto actionPrefix = (step->getStepType() == model::StepType::ACTION_STEP) ? "Action: " : "";
+				auto actionPrefix = (step.getStepType() == model::StepType::ACTION_STEP) ? "Action: " : "";
+
+				jsonStep->addMember("name", actionPrefix + step.getName());
+				jsonStep->addMember("status", translateStatusToString(step.getStatus()));
+				jsonStep->addMember("stage", translateStageToString(step.getStage()));
+				jsonStep->addMember("start", step.getStart());
+				jsonStep->addMember("stop", step.getStop());
 
-				jsonStep->addMember("name", actionPrefix + step->getName());
-				jsonStep->addMember("status", translateStatusToString(step->getStatus()));
-				jsonStep->addMember("stage", translateStageToString(step->getStage()));
-				jsonStep->addMember("start", step->getStart());
-				jsonStep->addMember("stop", step->getStop());
+				size_t lastNestedStep = std::min(last, i + 1 + step.getNestedStepsCount());
+				addStepsToJSON(steps, i + 1, lastNestedStep, *jsonStep);
 
 				jsonStepsArray->addArrayValue(std::move(jsonStep));
 			}
@@ -3,20 +3,22 @@
 #include "ITestSuiteJSONSerializer.h"
 
 #include <memory>
+#include <deque>
+#include <memory_resource>
 #include <vector>
 
 
 namespace systelab { namespace json {
 	class IJSONAdapter;
+	class IJSONDocument;
 	class IJSONValue;
 }}
 
 namespace systelab { namespace gtest_allure { namespace model {
-	class Action;
-	class ExpectedResult;
 	class Label;
 	class Link;
 	class Parameter;
+	class Step;
 	class TestCase;
 	class TestSuite;
 	enum class Status;
@@ -32,13 +34,15 @@ namespace systelab { namespace gtest_allure { namespace service {
 		virtual ~TestSuiteJSONSerializer() = default;
 
 		std::string serialize(const model::TestSuite&) const override;
+		void serialize(const model::TestSuite&, std::string& output) const override;
 
 	private:
+		std::unique_ptr<json::IJSONDocument> buildDocument(const model::TestSuite&) const;
 		void addTestSuiteToJSON(const model::TestSuite&, json::IJSONValue&) const;
 		void addLabelsToJSON(const model::TestSuite&, json::IJSONValue&) const;
-		void addLinksToJSON(const std::vector<model::Link>&, json::IJSONValue&) const;
-		void addTestCasesToJSON(const std::vector<model::TestCase>&, json::IJSONValue&) const;
-		void addTestCaseStepsToJSON(const model::TestCase& testCase, json::IJSONValue&) const;
+		void addLinksToJSON(const std::pmr::vector<model::Link>&, json::IJSONValue&) const;
+		void addTestCasesToJSON(const std::pmr::deque<model::TestCase>&, json::IJSONValue&) const;
+		void addStepsToJSON(const std::pmr::vector<model::Step>&, size_t first, size_t last, json::IJSONValue&) const;
 
 		std::string translateStatusToString(model::Status) const;
 		std::string translateStageToString(model::Stage) const;
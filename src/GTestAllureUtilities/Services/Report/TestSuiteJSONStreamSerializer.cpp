@@ -0,0 +1,186 @@
+#include "TestSuiteJSONStreamSerializer.h"
+
+#include "Model/StepType.h"
+#include "Model/TestSuite.h"
+#include "RapidJSONAdapter/JSONStringOutputStream.h"
+
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	namespace {
+
+		using json::rapidjson::JSONStringOutputStream;
+		typedef rapidjson::Writer<JSONStringOutputStream> SuiteWriter;
+
+		const char* translateStatusToString(model::Status status)
+		{
+			switch (status)
+			{
+				case model::Status::SKIPPED: return "skipped";
+				case model::Status::BROKEN: return "broken";
+				case model::Status::FAILED: return "failed";
+				case model::Status::PASSED: return "passed";
+				default: return "unknown";
+			}
+		}
+
+		const char* translateStageToString(model::Stage stage)
+		{
+			switch (stage)
+			{
+				case model::Stage::FINISHED: return "finished";
+				case model::Stage::SCHEDULED: return "scheduled";
+				case model::Stage::INTERRUPTED: return "interrupted";
+				case model::Stage::RUNNING: return "running";
+				default: return "pending";
+			}
+		}
+
+		void writeString(SuiteWriter& writer, const std::string& value)
+		{
+			writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+		}
+
+		template <typename Item>
+		void writeExecution(SuiteWriter& writer, const std::string& name, const Item& item)
+		{
+			writer.Key("name");
+			writeString(writer, name);
+			writer.Key("status");
+			writer.String(translateStatusToString(item.getStatus()));
+			writer.Key("stage");
+			writer.String(translateStageToString(item.getStage()));
+			writer.Key("start");
+			writer.Int64(item.getStart());
+			writer.Key("stop");
+			writer.Int64(item.getStop());
+		}
+
+		void writeLabel(SuiteWriter& writer, const std::string& name, const std::string& value)
+		{
+			writer.StartObject();
+			writer.Key("name");
+			writeString(writer, name);
+			writer.Key("value");
+			writeString(writer, value);
+			writer.EndObject();
+		}
+
+		void writeLabels(SuiteWriter& writer, const model::TestSuite& testSuite)
+		{
+			writer.Key("labels");
+			writer.StartArray();
+			writeLabel(writer, "suite", testSuite.getName());
+			for (const auto& label : testSuite.getLabels())
+			{
+				writeLabel(writer, label.getName(), label.getValue());
+			}
+			writer.EndArray();
+		}
+
+		void writeLinks(SuiteWriter& writer, const model::TestSuite& testSuite)
+		{
+			const auto& links = testSuite.getLinks();
+			if (links.size() > 0)
+			{
+				writer.Key("links");
+				writer.StartArray();
+				for (const auto& link : links)
+				{
+					writer.StartObject();
+					writer.Key("name");
+					writeString(writer, link.getName());
+					writer.Key("url");
+					writeString(writer, link.getURL());
+					writer.Key("type");
+					writeString(writer, link.getType());
+					writer.EndObject();
+				}
+				writer.EndArray();
+			}
+		}
+
+		// Nested steps follow their parent step, which records how many of them there are
+		void writeSteps(SuiteWriter& writer, const std::pmr::vector<model::Step>& steps,
+						size_t first, size_t last, std::string& nameBuffer)
+		{
+			if (first < last)
+			{
+				writer.Key("steps");
+				writer.StartArray();
+				for (size_t i = first; i < last; i += steps[i].getNestedStepsCount() + 1)
+				{
+					const model::Step& step = steps[i];
+					nameBuffer.assign((step.getStepType() == model::StepType::ACTION_STEP) ? "Action: " : "");
+					nameBuffer.append(step.getName());
+
+					writer.StartObject();
+					writeExecution(writer, nameBuffer, step);
+					writeSteps(writer, steps, i + 1, std::min(last, i + 1 + step.getNestedStepsCount()), nameBuffer);
+					writer.EndObject();
+				}
+				writer.EndArray();
+			}
+		}
+
+		void writeTestCases(SuiteWriter& writer, const model::TestSuite& testSuite)
+		{
+			const auto& testCases = testSuite.getTestCases();
+			if (testCases.size() > 0)
+			{
+				std::string nameBuffer;
+
+				writer.Key("steps");
+				writer.StartArray();
+				for (const auto& testCase : testCases)
+				{
+					nameBuffer.assign("Action: ");
+					nameBuffer.append(testCase.getName());
+
+					writer.StartObject();
+					writeExecution(writer, nameBuffer, testCase);
+					const auto& steps = testCase.getSteps();
+					writeSteps(writer, steps, 0, steps.size(), nameBuffer);
+					writer.EndObject();
+				}
+				writer.EndArray();
+			}
+		}
+	}
+
+	TestSuiteJSONStreamSerializer::TestSuiteJSONStreamSerializer()
+	{
+	}
+
+	std::string TestSuiteJSONStreamSerializer::serialize(const model::TestSuite& testSuite) const
+	{
+		std::string output;
+		serialize(testSuite, output);
+		return output;
+	}
+
+	void TestSuiteJSONStreamSerializer::serialize(const model::TestSuite& testSuite, std::string& output) const
+	{
+		output.clear();
+		JSONStringOutputStream stream(output);
+		SuiteWriter writer(stream);
+
+		writer.StartObject();
+		if (model::Format::ALLURE_FOR_JENKINS != testSuite.getFormat())
+		{
+			writer.Key("uuid");
+			writeString(writer, testSuite.getUUID());
+		}
+
+		writeExecution(writer, testSuite.getName(), testSuite);
+		writeLabels(writer, testSuite);
+		writeLinks(writer, testSuite);
+		writeTestCases(writer, testSuite);
+		writer.EndObject();
+	}
+
+}}}
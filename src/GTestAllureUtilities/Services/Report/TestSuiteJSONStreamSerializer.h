@@ -0,0 +1,22 @@
+#pragma once
+
+#include "ITestSuiteJSONSerializer.h"
+
+#include <string>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Writes the same JSON as TestSuiteJSONSerializer, but straight from the model
+	// into the output buffer: no intermediate document nor JSON adapter values.
+	class TestSuiteJSONStreamSerializer : public ITestSuiteJSONSerializer
+	{
+	public:
+		TestSuiteJSONStreamSerializer();
+		virtual ~TestSuiteJSONStreamSerializer() = default;
+
+		std::string serialize(const model::TestSuite&) const override;
+		void serialize(const model::TestSuite&, std::string& output) const override;
+	};
+
+}}}
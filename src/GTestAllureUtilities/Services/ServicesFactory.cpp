@@ -1,5 +1,6 @@
 #include "ServicesFactory.h"
 
+#include "Model/TestProgram.h"
 #include "Model/TestSuite.h"
 #include "Services/EventHandlers/TestCaseEndEventHandler.h"
 #include "Services/EventHandlers/TestCaseStartEventHandler.h"
@@ -13,10 +14,12 @@
 #include "Services/GoogleTest/GTestStatusChecker.h"
 #include "Services/Property/TestCasePropertySetter.h"
 #include "Services/Property/TestSuitePropertySetter.h"
+#include "Services/System/CoarseTimeService.h"
 #include "Services/System/FileService.h"
 #include "Services/System/TimeService.h"
 #include "Services/System/UUIDGeneratorService.h"
 #include "Services/Report/TestSuiteJSONSerializer.h"
+#include "Services/Report/TestSuiteJSONStreamSerializer.h"
 #include "Services/Report/TestProgramJSONBuilder.h"
 
 #include "RapidJSONAdapter/JSONAdapter.h"
@@ -24,11 +27,36 @@
 
 namespace systelab { namespace gtest_allure { namespace service {
 
+	namespace {
+
+		std::unique_ptr<ITestSuiteJSONSerializer> buildTestSuiteJSONSerializerFor(const model::TestProgram& testProgram)
+		{
+			if (testProgram.getReportSerializer() == model::ReportSerializer::JSON_STREAM)
+			{
+				return std::make_unique<TestSuiteJSONStreamSerializer>();
+			}
+
+			auto jsonAdapter = std::make_unique<json::rapidjson::JSONAdapter>();
+			return std::make_unique<TestSuiteJSONSerializer>(std::move(jsonAdapter));
+		}
+	}
+
 	ServicesFactory::ServicesFactory(model::TestProgram& testProgram)
 		:m_testProgram(testProgram)
+		,m_gtestStatusChecker(std::make_unique<GTestStatusChecker>())
+		,m_testSuitePropertySetter(std::make_unique<TestSuitePropertySetter>(testProgram))
+		,m_testCasePropertySetter(std::make_unique<TestCasePropertySetter>(testProgram))
 	{
+		for (auto clockType : { model::ClockType::PRECISE, model::ClockType::COARSE })
+		{
+			unsigned int index = static_cast<unsigned int>(clockType);
+			m_testStepStartEventHandlers[index] = std::make_unique<TestStepStartEventHandler>(m_testProgram, buildTimeService(clockType));
+			m_testStepEndEventHandlers[index] = std::make_unique<TestStepEndEventHandler>(m_testProgram, buildTimeService(clockType));
+		}
 	}
 
+	ServicesFactory::~ServicesFactory() = default;
+
 
 	// GTest services
 	std::unique_ptr<::testing::TestEventListener> ServicesFactory::buildGTestEventListener() const
@@ -91,7 +119,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 	std::unique_ptr<ITestSuiteEndEventHandler> ServicesFactory::buildTestSuiteEndEventHandler() const
 	{
 		auto timeService = buildTimeService();
-		return std::make_unique<TestSuiteEndEventHandler>(m_testProgram, std::move(timeService));
+		auto testProgramJSONBuilder = buildTestProgramJSONBuilder();
+		return std::make_unique<TestSuiteEndEventHandler>(m_testProgram, std::move(timeService), std::move(testProgramJSONBuilder));
 	}
 
 	std::unique_ptr<ITestProgramEndEventHandler> ServicesFactory::buildTestProgramEndEventHandler() const
@@ -116,15 +145,16 @@ namespace systelab { namespace gtest_allure { namespace service {
 	// JSON services
 	std::unique_ptr<ITestProgramJSONBuilder> ServicesFactory::buildTestProgramJSONBuilder() const
 	{
-		auto testSuiteJSONSerializer = buildTestSuiteJSONSerializer();
+		// Workers (and their serializers) are set up when the files are built, so that the number
+		// of report workers and the serializer can be changed until then. The builder does not keep
+		// any reference to this factory, which may be replaced before the files are built.
 		auto fileService = buildFileService();
-		return std::make_unique<TestProgramJSONBuilder>(std::move(testSuiteJSONSerializer), std::move(fileService));
+		return std::make_unique<TestProgramJSONBuilder>(&buildTestSuiteJSONSerializerFor, std::move(fileService));
 	}
 
 	std::unique_ptr<ITestSuiteJSONSerializer> ServicesFactory::buildTestSuiteJSONSerializer() const
 	{
-		auto jsonAdapter = std::make_unique<json::rapidjson::JSONAdapter>();
-		return std::make_unique<TestSuiteJSONSerializer>(std::move(jsonAdapter));
+		return buildTestSuiteJSONSerializerFor(m_testProgram);
 	}
 
 
@@ -141,10 +171,47 @@ namespace systelab { namespace gtest_allure { namespace service {
 
 	std::unique_ptr<ITimeService> ServicesFactory::buildTimeService() const
 	{
+		return buildTimeService(m_testProgram.getClockType());
+	}
+
+	std::unique_ptr<ITimeService> ServicesFactory::buildTimeService(model::ClockType clockType) const
+	{
+		if (clockType == model::ClockType::COARSE)
+		{
+			return std::make_unique<CoarseTimeService>();
+		}
+
 		return std::make_unique<TimeService>();
 	}
 
 
+	// Long-lived instances
+	const IGTestStatusChecker& ServicesFactory::getGTestStatusChecker() const
+	{
+		return *m_gtestStatusChecker;
+	}
+
+	const ITestStepStartEventHandler& ServicesFactory::getTestStepStartEventHandler() const
+	{
+		return *m_testStepStartEventHandlers[static_cast<unsigned int>(m_testProgram.getClockType())];
+	}
+
+	const ITestStepEndEventHandler& ServicesFactory::getTestStepEndEventHandler() const
+	{
+		return *m_testStepEndEventHandlers[static_cast<unsigned int>(m_testProgram.getClockType())];
+	}
+
+	const ITestSuitePropertySetter& ServicesFactory::getTestSuitePropertySetter() const
+	{
+		return *m_testSuitePropertySetter;
+	}
+
+	const ITestCasePropertySetter& ServicesFactory::getTestCasePropertySetter() const
+	{
+		return *m_testCasePropertySetter;
+	}
+
+
 	// Unique instance (to be used by integration tests)
 	std::unique_ptr<IServicesFactory> ServicesFactory::m_instance = nullptr;
 
@@ -2,6 +2,8 @@
 
 #include "IServicesFactory.h"
 
+#include "Model/ClockType.h"
+
 
 namespace systelab { namespace gtest_allure { namespace model {
 	class TestProgram;
@@ -13,7 +15,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 	{
 	public:
 		ServicesFactory(model::TestProgram&);
-		virtual ~ServicesFactory() = default;
+		virtual ~ServicesFactory();
 
 		// GTest services
 		std::unique_ptr<::testing::TestEventListener> buildGTestEventListener() const override;
@@ -42,12 +44,32 @@ namespace systelab { namespace gtest_allure { namespace service {
 		std::unique_ptr<IFileService> buildFileService() const override;
 		std::unique_ptr<ITimeService> buildTimeService() const override;
 
+		// Long-lived instances (built once by the constructor)
+		const IGTestStatusChecker& getGTestStatusChecker() const override;
+		const ITestStepStartEventHandler& getTestStepStartEventHandler() const override;
+		const ITestStepEndEventHandler& getTestStepEndEventHandler() const override;
+		const ITestSuitePropertySetter& getTestSuitePropertySetter() const override;
+		const ITestCasePropertySetter& getTestCasePropertySetter() const override;
+
 		// Unique instance (to be used by integration tests)
 		static IServicesFactory* getInstance();
 		static void setInstance(std::unique_ptr<IServicesFactory>);
 
 	private:
+		std::unique_ptr<ITimeService> buildTimeService(model::ClockType) const;
+
+	private:
+		static const unsigned int CLOCK_TYPES_COUNT = 2;
+
 		model::TestProgram& m_testProgram;
+
+		// Handlers taking timestamps are built once per clock type, as it may be changed at any time
+		std::unique_ptr<IGTestStatusChecker> m_gtestStatusChecker;
+		std::unique_ptr<ITestStepStartEventHandler> m_testStepStartEventHandlers[CLOCK_TYPES_COUNT];
+		std::unique_ptr<ITestStepEndEventHandler> m_testStepEndEventHandlers[CLOCK_TYPES_COUNT];
+		std::unique_ptr<ITestSuitePropertySetter> m_testSuitePropertySetter;
+		std::unique_ptr<ITestCasePropertySetter> m_testCasePropertySetter;
+
 		static std::unique_ptr<IServicesFactory> m_instance;
 	};
 
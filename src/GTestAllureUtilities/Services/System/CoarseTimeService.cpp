@@ -0,0 +1,56 @@
+#include "CoarseTimeService.h"
+
+#include <chrono>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	namespace {
+
+		int64_t getMonotonicTimeNs()
+		{
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+			struct timespec now;
+			clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+			return (static_cast<int64_t>(now.tv_sec) * 1000000000) + now.tv_nsec;
+#else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+		}
+
+		// Epoch offset of the coarse monotonic clock, computed once at startup
+		int64_t getEpochOffsetNs()
+		{
+			static const int64_t epochOffsetNs =
+				std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::system_clock::now().time_since_epoch()).count() - getMonotonicTimeNs();
+			return epochOffsetNs;
+		}
+	}
+
+	CoarseTimeService::CoarseTimeService()
+	{
+		getEpochOffsetNs();
+	}
+
+	time_t CoarseTimeService::getCurrentTime() const
+	{
+		return static_cast<time_t>(getCurrentTimeNs() / 1000000000);
+	}
+
+	int64_t CoarseTimeService::getCurrentTimeMs() const
+	{
+		return getCurrentTimeNs() / 1000000;
+	}
+
+	int64_t CoarseTimeService::getCurrentTimeNs() const
+	{
+		return getEpochOffsetNs() + getMonotonicTimeNs();
+	}
+
+}}}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ITimeService.h"
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Cheaper alternative to TimeService for hot-path timestamps. Reads the
+	// kernel's tick-cached monotonic clock (CLOCK_MONOTONIC_COARSE, served from
+	// the vDSO without a hardware counter read), so its resolution is the kernel
+	// tick (typically 1-4 ms). Falls back to the steady clock on other platforms.
+	class CoarseTimeService : public ITimeService
+	{
+	public:
+		CoarseTimeService();
+		virtual ~CoarseTimeService() = default;
+
+		time_t getCurrentTime() const;
+		int64_t getCurrentTimeMs() const;
+		int64_t getCurrentTimeNs() const;
+	};
+
+}}}
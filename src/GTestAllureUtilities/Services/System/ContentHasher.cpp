@@ -0,0 +1,122 @@
+#include "ContentHasher.h"
+
+#include "HexTable.h"
+
+#include <cstring>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	namespace {
+
+		constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+		constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+		constexpr uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr uint64_t PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+		constexpr size_t BLOCK_SIZE = 16;
+
+		uint64_t readUInt64(const char* data)
+		{
+			uint64_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		uint64_t rotateLeft(uint64_t x, int k)
+		{
+			return (x << k) | (x >> (64 - k));
+		}
+	}
+
+	ContentHasher::Hash ContentHasher::hash(std::string_view content)
+	{
+		const char* data = content.data();
+		size_t remaining = content.size();
+
+		// Accumulators are rotated and multiplied before adding each block, so that
+		// the order of blocks matters and no block erases the previous state
+		uint64_t accumulator1 = PRIME_1;
+		uint64_t accumulator2 = PRIME_2;
+		auto addBlock = [&accumulator1, &accumulator2](const char* block)
+		{
+			const uint64_t first = readUInt64(block);
+			const uint64_t second = readUInt64(block + 8);
+			accumulator1 = rotateLeft(accumulator1, 29) * PRIME_1 + multiplyFold(first ^ PRIME_2, second ^ PRIME_3);
+			accumulator2 = rotateLeft(accumulator2, 31) * PRIME_4 + multiplyFold(second ^ PRIME_5, rotateLeft(first, 32) ^ PRIME_1);
+		};
+
+		for (; remaining >= BLOCK_SIZE; data += BLOCK_SIZE, remaining -= BLOCK_SIZE)
+		{
+			addBlock(data);
+		}
+
+		// Last partial block is padded with zeros (the length disambiguates it)
+		if (remaining > 0)
+		{
+			char lastBlock[BLOCK_SIZE] = {};
+			std::memcpy(lastBlock, data, remaining);
+			addBlock(lastBlock);
+		}
+
+		const uint64_t length = static_cast<uint64_t>(content.size());
+		return { avalanche(accumulator1 + length * PRIME_3), avalanche(accumulator2 ^ rotateLeft(length * PRIME_5, 17)) };
+	}
+
+	void ContentHasher::toHex(const Hash& hash, Buffer& buffer)
+	{
+		char* output = buffer.data();
+		for (uint64_t value : { hash.high, hash.low })
+		{
+			for (int shift = 56; shift >= 0; shift -= 8)
+			{
+				const auto& digits = HEX_TABLE.digits[(value >> shift) & 0xFF];
+				*output++ = digits[0];
+				*output++ = digits[1];
+			}
+		}
+	}
+
+	std::string ContentHasher::toHex(const Hash& hash)
+	{
+		Buffer buffer;
+		toHex(hash, buffer);
+		return std::string(buffer.data(), buffer.size());
+	}
+
+	std::string ContentHasher::hashToHex(std::string_view content)
+	{
+		return toHex(hash(content));
+	}
+
+	uint64_t ContentHasher::multiplyFold(uint64_t x, uint64_t y)
+	{
+#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 product = static_cast<unsigned __int128>(x) * y;
+		return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+		// 64x64->128 bit product from its 32-bit halves
+		const uint64_t lowLow = (x & 0xFFFFFFFFULL) * (y & 0xFFFFFFFFULL);
+		const uint64_t highLow = (x >> 32) * (y & 0xFFFFFFFFULL);
+		const uint64_t lowHigh = (x & 0xFFFFFFFFULL) * (y >> 32);
+		const uint64_t highHigh = (x >> 32) * (y >> 32);
+
+		const uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFFULL) + lowHigh;
+		const uint64_t upper = (highLow >> 32) + (cross >> 32) + highHigh;
+		const uint64_t lower = (cross << 32) | (lowLow & 0xFFFFFFFFULL);
+		return lower ^ upper;
+#endif
+	}
+
+	uint64_t ContentHasher::avalanche(uint64_t value)
+	{
+		value ^= value >> 33;
+		value *= PRIME_2;
+		value ^= value >> 29;
+		value *= PRIME_3;
+		value ^= value >> 32;
+		return value;
+	}
+
+}}}
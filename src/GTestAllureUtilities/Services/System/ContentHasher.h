@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Fast non-cryptographic 128-bit hash of a content, loosely modelled on XXH3 (but
+	// not XXH3 itself, so its values differ from those of xxHash): 16-byte blocks are
+	// folded through 64x64->128 bit multiplications into two accumulators, which are
+	// avalanched with the content length. Not meant to resist crafted collisions.
+	// Attachment files are named after this hash, and AttachmentWriter::saveOnce does
+	// not write a file already saved under the same name: a content colliding with an
+	// earlier one would be reported with the earlier content.
+	class ContentHasher
+	{
+	public:
+		static constexpr size_t HASH_LENGTH = 32;
+		using Buffer = std::array<char, HASH_LENGTH>;
+
+		struct Hash
+		{
+			uint64_t high;
+			uint64_t low;
+
+			bool operator== (const Hash&) const = default;
+		};
+
+	public:
+		static Hash hash(std::string_view content);
+
+		// Lowercase hex digits of the hash
+		static void toHex(const Hash&, Buffer&);
+		static std::string toHex(const Hash&);
+		static std::string hashToHex(std::string_view content);
+
+	private:
+		static uint64_t multiplyFold(uint64_t x, uint64_t y);
+		static uint64_t avalanche(uint64_t value);
+	};
+
+}}}
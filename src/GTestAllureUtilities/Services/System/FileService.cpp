@@ -27,7 +27,7 @@ namespace systelab { namespace gtest_allure { namespace service {
 			outputFileStream.exceptions(~std::ofstream::goodbit);
 			outputFileStream.open(filePath);
 
-			outputFileStream << fileContent;
+			outputFileStream.write(fileContent.data(), (std::streamsize) fileContent.size());
 			outputFileStream.close();
 		}
 		catch (std::ofstream::failure& exc)
@@ -110,7 +110,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 		mode_t nMode = 0733;
 		nError = mkdir(folderPath.c_str(), nMode);
 #endif
-		if (nError != 0)
+		// Several report workers may create the same folder at once
+		if ((nError != 0) && !folderExists(folderPath))
 		{
 			throw UnableToWriteFileException(folderPath, "Unable to create folder");
 		}
@@ -0,0 +1,25 @@
+#pragma once
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Two lowercase hex digits per byte value
+	struct HexTable
+	{
+		char digits[256][2];
+
+		constexpr HexTable()
+			:digits()
+		{
+			constexpr char hex[] = "0123456789abcdef";
+			for (int i = 0; i < 256; i++)
+			{
+				digits[i][0] = hex[i >> 4];
+				digits[i][1] = hex[i & 0x0F];
+			}
+		}
+	};
+
+	inline constexpr HexTable HEX_TABLE;
+
+}}}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <ctime>
 #include <string>
 
 
@@ -11,6 +13,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 		virtual ~ITimeService() = default;
 
 		virtual time_t getCurrentTime() const = 0;
+		virtual int64_t getCurrentTimeMs() const = 0;
+		virtual int64_t getCurrentTimeNs() const = 0;
 	};
 
 }}}
@@ -0,0 +1,120 @@
+#include "OutputFolder.h"
+
+#include <filesystem>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	OutputFolder::OutputFolder()
+		:m_path()
+		,m_handle(-1)
+	{
+	}
+
+	OutputFolder::~OutputFolder()
+	{
+		close();
+	}
+
+	void OutputFolder::open(const std::string& folderPath)
+	{
+		close();
+
+		std::error_code error;
+		std::filesystem::create_directories(folderPath, error);
+		if (error)
+		{
+			throw UnableToOpenFolderException(folderPath);
+		}
+
+#if !defined(_WIN32)
+		m_handle = ::open(folderPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (m_handle < 0)
+		{
+			throw UnableToOpenFolderException(folderPath);
+		}
+#endif
+		m_path = folderPath;
+	}
+
+	void OutputFolder::close()
+	{
+#if !defined(_WIN32)
+		if (m_handle >= 0)
+		{
+			::close(m_handle);
+		}
+#endif
+		m_handle = -1;
+		m_path.clear();
+	}
+
+	bool OutputFolder::isOpen() const
+	{
+		return !m_path.empty();
+	}
+
+	const std::string& OutputFolder::getPath() const
+	{
+		return m_path;
+	}
+
+	void OutputFolder::saveFile(const std::string& fileName, const char* content, size_t size) const
+	{
+		writeFile(fileName, content, size, false);
+	}
+
+	void OutputFolder::appendFile(const std::string& fileName, const char* content, size_t size) const
+	{
+		writeFile(fileName, content, size, true);
+	}
+
+	void OutputFolder::writeFile(const std::string& fileName, const char* content, size_t size, bool append) const
+	{
+#if defined(_WIN32)
+		std::ios::openmode openMode = std::ios::binary | (append ? std::ios::app : std::ios::trunc);
+		std::ofstream outputFileStream(std::filesystem::path(m_path) / fileName, openMode);
+		outputFileStream.write(content, static_cast<std::streamsize>(size));
+		if (!outputFileStream)
+		{
+			throw UnableToWriteFileException(fileName);
+		}
+#else
+		int openFlags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+		int fileHandle = ::openat(m_handle, fileName.c_str(), openFlags, 0644);
+		if (fileHandle < 0)
+		{
+			throw UnableToWriteFileException(fileName);
+		}
+
+		while (size > 0)
+		{
+			ssize_t written = ::write(fileHandle, content, size);
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				::close(fileHandle);
+				throw UnableToWriteFileException(fileName);
+			}
+
+			content += written;
+			size -= static_cast<size_t>(written);
+		}
+
+		::close(fileHandle);
+#endif
+	}
+
+}}}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// Output folder created once and kept open, so that files can be created
+	// relative to its handle without resolving nor checking the path again.
+	class OutputFolder
+	{
+	public:
+		OutputFolder();
+		virtual ~OutputFolder();
+
+		OutputFolder(const OutputFolder&) = delete;
+		OutputFolder& operator= (const OutputFolder&) = delete;
+
+		void open(const std::string& folderPath);
+		void close();
+
+		bool isOpen() const;
+		const std::string& getPath() const;
+
+		void saveFile(const std::string& fileName, const char* content, size_t size) const;
+		void appendFile(const std::string& fileName, const char* content, size_t size) const;
+
+	public:
+		struct UnableToOpenFolderException : std::runtime_error
+		{
+			UnableToOpenFolderException(const std::string& folderPath)
+				:std::runtime_error("Unable to open output folder '" + folderPath + "'")
+			{}
+		};
+
+		struct UnableToWriteFileException : std::runtime_error
+		{
+			UnableToWriteFileException(const std::string& fileName)
+				:std::runtime_error("Unable to write file '" + fileName + "' into output folder")
+			{}
+		};
+
+	private:
+		void writeFile(const std::string& fileName, const char* content, size_t size, bool append) const;
+
+	private:
+		std::string m_path;
+		int m_handle;
+	};
+
+}}}
@@ -1,17 +1,52 @@
 #include "TimeService.h"
 
-#include <ctime>
+#include <chrono>
 
 
 namespace systelab { namespace gtest_allure { namespace service {
 
+	namespace {
+
+		struct ClockAnchor
+		{
+			std::chrono::steady_clock::time_point steadyBase;
+			std::chrono::nanoseconds systemBase;
+
+			ClockAnchor()
+				:steadyBase(std::chrono::steady_clock::now())
+				,systemBase(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::system_clock::now().time_since_epoch()))
+			{
+			}
+		};
+
+		const ClockAnchor& getClockAnchor()
+		{
+			static const ClockAnchor clockAnchor;
+			return clockAnchor;
+		}
+	}
+
 	TimeService::TimeService()
 	{
+		getClockAnchor();
 	}
 
 	time_t TimeService::getCurrentTime() const
 	{
-		return std::time(0);
+		return static_cast<time_t>(getCurrentTimeNs() / 1000000000);
+	}
+
+	int64_t TimeService::getCurrentTimeMs() const
+	{
+		return getCurrentTimeNs() / 1000000;
+	}
+
+	int64_t TimeService::getCurrentTimeNs() const
+	{
+		const ClockAnchor& clockAnchor = getClockAnchor();
+		const auto elapsed = std::chrono::steady_clock::now() - clockAnchor.steadyBase;
+		return (clockAnchor.systemBase + std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)).count();
 	}
 
 }}}
@@ -5,6 +5,9 @@
 
 namespace systelab { namespace gtest_allure { namespace service {
 
+	// Wall clock time computed from the system clock sampled once at startup plus
+	// the time elapsed on the steady clock, so it never goes backwards nor jumps
+	// when the system clock is adjusted.
 	class TimeService : public ITimeService
 	{
 	public:
@@ -12,6 +15,8 @@ namespace systelab { namespace gtest_allure { namespace service {
 		virtual ~TimeService() = default;
 
 		time_t getCurrentTime() const;
+		int64_t getCurrentTimeMs() const;
+		int64_t getCurrentTimeNs() const;
 	};
 
 }}}
@@ -0,0 +1,156 @@
+#include "UUIDGenerator.h"
+
+#include "HexTable.h"
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	namespace {
+
+		// xoshiro256** (Blackman & Vigna): fast, 256 bits of state, seeded through splitmix64
+		class Xoshiro256StarStar
+		{
+		public:
+			Xoshiro256StarStar()
+			{
+				std::random_device randomDevice;
+				uint64_t seed = (static_cast<uint64_t>(randomDevice()) << 32) ^ randomDevice();
+				seed ^= static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+				seed ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+				for (auto& word : m_state)
+				{
+					word = splitMix64(seed);
+				}
+			}
+
+			uint64_t next()
+			{
+				const uint64_t result = rotateLeft(m_state[1] * 5, 7) * 9;
+				const uint64_t t = m_state[1] << 17;
+
+				m_state[2] ^= m_state[0];
+				m_state[3] ^= m_state[1];
+				m_state[1] ^= m_state[2];
+				m_state[0] ^= m_state[3];
+				m_state[2] ^= t;
+				m_state[3] = rotateLeft(m_state[3], 45);
+
+				return result;
+			}
+
+		private:
+			static uint64_t rotateLeft(uint64_t x, int k)
+			{
+				return (x << k) | (x >> (64 - k));
+			}
+
+			static uint64_t splitMix64(uint64_t& x)
+			{
+				uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				return z ^ (z >> 31);
+			}
+
+		private:
+			uint64_t m_state[4];
+		};
+	}
+
+	void UUIDGenerator::generate(model::UUIDVersion version, Buffer& buffer)
+	{
+		uint64_t high;
+		if (version == model::UUIDVersion::V7)
+		{
+			// 48-bit Unix timestamp in ms, version 7, 12-bit sequence counter
+			const uint64_t prefix = nextTimeOrderedPrefix();
+			high = ((prefix >> 12) << 16) | 0x7000ULL | (prefix & 0x0FFFULL);
+		}
+		else
+		{
+			high = (nextRandom() & 0xFFFFFFFFFFFF0FFFULL) | 0x4000ULL;
+		}
+
+		const uint64_t low = (nextRandom() & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL; // variant 10xx
+
+		encode(high, low, buffer);
+	}
+
+	std::string UUIDGenerator::generate(model::UUIDVersion version)
+	{
+		Buffer buffer;
+		generate(version, buffer);
+		return std::string(buffer.data(), buffer.size());
+	}
+
+	std::string UUIDGenerator::generateV4()
+	{
+		return generate(model::UUIDVersion::V4);
+	}
+
+	std::string UUIDGenerator::generateV7()
+	{
+		return generate(model::UUIDVersion::V7);
+	}
+
+	void UUIDGenerator::encode(uint64_t high, uint64_t low, Buffer& buffer)
+	{
+		char* output = buffer.data();
+		auto writeBytes = [&output](uint64_t value, int firstByte, int lastByte)
+		{
+			for (int i = firstByte; i <= lastByte; i++)
+			{
+				const auto& digits = HEX_TABLE.digits[(value >> (56 - 8 * i)) & 0xFF];
+				*output++ = digits[0];
+				*output++ = digits[1];
+			}
+		};
+
+		writeBytes(high, 0, 3);
+		*output++ = '-';
+		writeBytes(high, 4, 5);
+		*output++ = '-';
+		writeBytes(high, 6, 7);
+		*output++ = '-';
+		writeBytes(low, 0, 1);
+		*output++ = '-';
+		writeBytes(low, 2, 7);
+	}
+
+	uint64_t UUIDGenerator::nextRandom()
+	{
+		static thread_local Xoshiro256StarStar generator;
+		return generator.next();
+	}
+
+	uint64_t UUIDGenerator::nextTimeOrderedPrefix()
+	{
+		// Timestamp (ms) followed by a 12-bit counter. When the counter wraps within
+		// a millisecond the timestamp runs slightly ahead, as allowed by RFC 9562.
+		static std::atomic<uint64_t> lastPrefix { 0 };
+
+		const uint64_t timePrefix = getUnixTimeMs() << 12;
+		uint64_t previousPrefix = lastPrefix.load(std::memory_order_relaxed);
+		uint64_t prefix;
+		do
+		{
+			prefix = (timePrefix > previousPrefix) ? timePrefix : (previousPrefix + 1);
+		}
+		while (!lastPrefix.compare_exchange_weak(previousPrefix, prefix, std::memory_order_relaxed));
+
+		return prefix;
+	}
+
+	uint64_t UUIDGenerator::getUnixTimeMs()
+	{
+		using namespace std::chrono;
+		return static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+	}
+
+}}}
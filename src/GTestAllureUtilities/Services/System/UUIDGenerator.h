@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Model/UUIDVersion.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace systelab { namespace gtest_allure { namespace service {
+
+	// RFC 9562 UUID generation from a per-thread PRNG seeded once, encoded with a
+	// lookup table into a fixed-size buffer (no streams nor intermediate strings).
+	// Version 7 UUIDs are strictly increasing process-wide: the 12 bits after the
+	// millisecond timestamp act as a counter, so lexical order is generation order.
+	class UUIDGenerator
+	{
+	public:
+		static constexpr size_t UUID_LENGTH = 36;
+		using Buffer = std::array<char, UUID_LENGTH>;
+
+	public:
+		static void generate(model::UUIDVersion, Buffer&);
+		static std::string generate(model::UUIDVersion);
+
+		static std::string generateV4();
+		static std::string generateV7();
+
+	private:
+		static void encode(uint64_t high, uint64_t low, Buffer&);
+		static uint64_t nextRandom();
+		static uint64_t getUnixTimeMs();
+		static uint64_t nextTimeOrderedPrefix();
+	};
+
+}}}
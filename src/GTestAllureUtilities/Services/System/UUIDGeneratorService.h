@@ -2,20 +2,21 @@
 
 #include "IUUIDGeneratorService.h"
 
+#include "Model/UUIDVersion.h"
+
 
 namespace systelab { namespace gtest_allure { namespace service {
 
 	class UUIDGeneratorService : public IUUIDGeneratorService
 	{
 	public:
-		UUIDGeneratorService();
+		explicit UUIDGeneratorService(model::UUIDVersion = model::UUIDVersion::V4);
 		virtual ~UUIDGeneratorService() = default;
 
 		std::string generateUUID() const;
 
 	private:
-		std::string generateHex(unsigned int length) const;
-		unsigned char generateRandomChar() const;
+		const model::UUIDVersion m_version;
 	};
 
 }}}
@@ -16,6 +16,8 @@ namespace systelab { namespace json {
 		virtual const IJSONValue& getRootValue() const = 0;
 
 		virtual std::string serialize(bool pretty = false) const = 0;
+		// Writes into the given buffer, replacing its contents but keeping its capacity
+		virtual void serialize(std::string& output, bool pretty = false) const = 0;
 	};
 
 }}
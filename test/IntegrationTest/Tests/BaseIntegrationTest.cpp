@@ -32,7 +32,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		service::ServicesFactory::setInstance(nullptr);
 	}
 
-	void BaseIntegrationTest::setCurrentTime(time_t currentTime)
+	void BaseIntegrationTest::setCurrentTime(int64_t currentTime)
 	{
 		m_currentTime = currentTime;
 	}
@@ -99,8 +99,8 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			[this]() -> service::ITimeService*
 			{
 				auto timeService = new MockTimeService();
-				ON_CALL(*timeService, getCurrentTime()).WillByDefault(Invoke(
-					[this]() -> time_t
+				ON_CALL(*timeService, getCurrentTimeMs()).WillByDefault(Invoke(
+					[this]() -> int64_t
 					{
 						return m_currentTime;
 					}
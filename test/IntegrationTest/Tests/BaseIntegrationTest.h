@@ -23,7 +23,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		void SetUp();
 		void TearDown();
 
-		void setCurrentTime(time_t);
+		void setCurrentTime(int64_t);
 		void setNextUUIDToGenerate(const std::string&);
 		StubEventListener& getEventListener() const;
 
@@ -41,7 +41,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 	private:
 		std::unique_ptr<StubEventListener> m_eventListener;
 
-		time_t m_currentTime;
+		int64_t m_currentTime;
 		std::string m_nextUUIDToGenerate;
 		std::vector<StubFile> m_savedFiles;
 
@@ -359,5 +359,109 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_TRUE(compareJSONs(expectedSavedFileContent, savedFile.m_content, getJSONAdapter()));
 	}
 
+	TEST_F(BasicTestCaseIntegrationTest, testProgramWithStepScopesAndCallableSteps)
+	{
+		AllureAPI::setOutputFolder("IntegrationTest\\OutputFolder");
+		AllureAPI::setTestProgramName("StepsTestProgram");
+		AllureAPI::setTMSLinksPattern("https://mytms.webpage.com/{}/refresh");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+
+		setCurrentTime(100);
+		setNextUUIDToGenerate("UUID-Steps");
+		listener.onTestSuiteStart("StepsTestSuite");
+
+		setCurrentTime(200);
+		listener.onTestStart("StepsTestCase");
+
+		{
+			setCurrentTime(210);
+			AllureAPI::StepScope step("Prepare input data");
+			setCurrentTime(220);
+		}
+
+		int result = 0;
+		setCurrentTime(230);
+		AllureAPI::addExpectedResult("Result is computed", [&result]() { result = 5 + 3; });
+		ASSERT_EQ(8, result);
+
+		setCurrentTime(240);
+		ASSERT_THROW(AllureAPI::addAction("Throwing action", []() { throw std::runtime_error("Step error"); }),
+					 std::runtime_error);
+
+		setCurrentTime(290);
+		listener.onTestEnd(model::Status::PASSED);
+
+		setCurrentTime(300);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+
+		listener.onProgramEnd();
+
+		ASSERT_EQ(1, getSavedFilesCount());
+		StubFile savedFile = getSavedFile(0);
+		ASSERT_EQ("IntegrationTest\\OutputFolder\\UUID-Steps-StepsTestProgram.json", savedFile.m_path);
+
+		std::string expectedSavedFileContent =
+			"{\n"
+			"    \"uuid\": \"UUID-Steps\",\n"
+			"    \"name\": \"StepsTestSuite\",\n"
+			"    \"status\": \"passed\",\n"
+			"    \"stage\": \"finished\",\n"
+			"    \"start\": 100,\n"
+			"    \"stop\": 300,\n"
+			"    \"labels\":\n"
+			"    [\n"
+			"        {\n"
+			"            \"name\": \"suite\",\n"
+			"            \"value\": \"StepsTestSuite\"\n"
+			"        }\n"
+			"    ],\n"
+			"    \"links\":\n"
+			"    [\n"
+			"        {\n"
+			"            \"name\": \"StepsTestSuite\",\n"
+			"            \"url\": \"https://mytms.webpage.com/StepsTestSuite/refresh\",\n"
+			"            \"type\": \"tms\"\n"
+			"        }\n"
+			"    ],\n"
+			"    \"steps\":\n"
+			"    [\n"
+			"        {\n"
+			"            \"name\": \"Action: StepsTestCase\",\n"
+			"            \"status\": \"passed\",\n"
+			"            \"stage\": \"finished\",\n"
+			"            \"start\": 200,\n"
+			"            \"stop\": 290,\n"
+			"            \"steps\":\n"
+			"            [\n"
+			"                {\n"
+			"                    \"name\": \"Action: Prepare input data\",\n"
+			"                    \"status\": \"passed\",\n"
+			"                    \"stage\": \"finished\",\n"
+			"                    \"start\": 210,\n"
+			"                    \"stop\": 220\n"
+			"                },\n"
+			"                {\n"
+			"                    \"name\": \"Result is computed\",\n"
+			"                    \"status\": \"passed\",\n"
+			"                    \"stage\": \"finished\",\n"
+			"                    \"start\": 230,\n"
+			"                    \"stop\": 230\n"
+			"                },\n"
+			"                {\n"
+			"                    \"name\": \"Action: Throwing action\",\n"
+			"                    \"status\": \"broken\",\n"
+			"                    \"stage\": \"finished\",\n"
+			"                    \"start\": 240,\n"
+			"                    \"stop\": 240\n"
+			"                }\n"
+			"            ]\n"
+			"        }\n"
+			"    ]\n"
+			"}";
+
+		ASSERT_TRUE(compareJSONs(expectedSavedFileContent, savedFile.m_content, getJSONAdapter()));
+	}
 
 }}}
@@ -0,0 +1,103 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include "GTestAllureUtilities/Services/Report/Allure2TestResult.h"
+#include "GTestAllureUtilities/Services/Report/Allure2TestResultJSONSerializer.h"
+
+#include "Model/TestProgram.h"
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class TMSLinkIntegrationTest : public testing::Test
+								 , public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+
+		// Renders the TMS link of a suite through AllureAPI, the Allure2 result
+		// serializer and the legacy report, in that order
+		std::vector<std::string> renderTMSLinks(const std::string& gtestSuiteName, const std::string& customSuiteName)
+		{
+			std::vector<std::string> tmsLinks;
+
+			auto& listener = getEventListener();
+			setNextUUIDToGenerate("UUID-" + gtestSuiteName);
+			listener.onTestSuiteStart(gtestSuiteName);
+			AllureAPI::beginTestSuite(); // As done by Allure2Listener
+			if (!customSuiteName.empty())
+			{
+				AllureAPI::setTestSuiteName(customSuiteName);
+			}
+			AllureAPI::setTMSId("TC-1");
+
+			AllureAPI::beginTestCase(gtestSuiteName, "TestCase", "UUID-TestCase");
+			listener.onTestStart("TestCase");
+			tmsLinks.push_back(AllureAPI::formatTMSLink("TC-1"));
+
+			service::Allure2TestResult result;
+			result.suiteName = gtestSuiteName;
+			result.configuration = AllureAPI::getConfiguration();
+			tmsLinks.push_back(extractURL(service::Allure2TestResultJSONSerializer().serialize(result)));
+
+			listener.onTestEnd(model::Status::PASSED);
+			AllureAPI::endTestCase();
+			listener.onTestSuiteEnd(model::Status::PASSED);
+
+			model::TestProgram& testProgram = AllureAPI::getTestProgram();
+			const model::TestSuite& testSuite = testProgram.getTestSuite(static_cast<unsigned int>(testProgram.getTestSuitesCount() - 1));
+			tmsLinks.push_back(testSuite.getLinks().back().getURL());
+
+			return tmsLinks;
+		}
+
+		std::string extractURL(const std::string& serializedResult)
+		{
+			const std::string urlKey = "\"url\":\"";
+			size_t urlStart = serializedResult.find(urlKey);
+			if (urlStart == std::string::npos)
+			{
+				return "";
+			}
+
+			urlStart += urlKey.size();
+			return serializedResult.substr(urlStart, serializedResult.find('"', urlStart) - urlStart);
+		}
+	};
+
+
+	TEST_F(TMSLinkIntegrationTest, testSuitePlaceholderIsRenderedWithSameSuiteNameByAllReports)
+	{
+		AllureAPI::setOutputFolder("IntegrationTest\\OutputFolder");
+		AllureAPI::setTestProgramName("TMSLinks");
+		AllureAPI::setTMSLinksPattern("http://tms/{suite}/{id}");
+		getEventListener().onProgramStart();
+
+		std::vector<std::string> gtestSuiteNameLinks = { "http://tms/GTestSuite/TC-1",
+														 "http://tms/GTestSuite/TC-1",
+														 "http://tms/GTestSuite/TC-1" };
+		std::vector<std::string> customSuiteNameLinks = { "http://tms/CustomSuite/TC-1",
+														  "http://tms/CustomSuite/TC-1",
+														  "http://tms/CustomSuite/TC-1" };
+		std::vector<std::string> otherGTestSuiteNameLinks = { "http://tms/OtherGTestSuite/TC-1",
+															  "http://tms/OtherGTestSuite/TC-1",
+															  "http://tms/OtherGTestSuite/TC-1" };
+		ASSERT_EQ(gtestSuiteNameLinks, renderTMSLinks("GTestSuite", ""));
+		ASSERT_EQ(customSuiteNameLinks, renderTMSLinks("CustomGTestSuite", "CustomSuite"));
+		ASSERT_EQ(otherGTestSuiteNameLinks, renderTMSLinks("OtherGTestSuite", ""));
+
+		getEventListener().onProgramEnd();
+	}
+
+}}}
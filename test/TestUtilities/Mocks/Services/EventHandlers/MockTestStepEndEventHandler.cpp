@@ -0,0 +1,11 @@
+#include "stdafx.h"
+#include "MockTestStepEndEventHandler.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	MockTestStepEndEventHandler::MockTestStepEndEventHandler() = default;
+	MockTestStepEndEventHandler::~MockTestStepEndEventHandler() = default;
+
+}}}
+
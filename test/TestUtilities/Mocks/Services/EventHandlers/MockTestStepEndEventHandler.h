@@ -0,0 +1,18 @@
+#pragma once
+
+#include "GTestAllureUtilities/Services/EventHandlers/ITestStepEndEventHandler.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	class MockTestStepEndEventHandler : public service::ITestStepEndEventHandler
+	{
+	public:
+		MockTestStepEndEventHandler();
+		virtual ~MockTestStepEndEventHandler();
+
+		MOCK_CONST_METHOD1(handleTestStepEnd, void(model::Status));
+	};
+
+}}}
+
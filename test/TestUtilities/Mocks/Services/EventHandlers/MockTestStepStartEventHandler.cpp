@@ -0,0 +1,11 @@
+#include "stdafx.h"
+#include "MockTestStepStartEventHandler.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	MockTestStepStartEventHandler::MockTestStepStartEventHandler() = default;
+	MockTestStepStartEventHandler::~MockTestStepStartEventHandler() = default;
+
+}}}
+
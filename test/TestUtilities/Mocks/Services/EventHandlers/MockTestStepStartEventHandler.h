@@ -0,0 +1,18 @@
+#pragma once
+
+#include "GTestAllureUtilities/Services/EventHandlers/ITestStepStartEventHandler.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	class MockTestStepStartEventHandler : public service::ITestStepStartEventHandler
+	{
+	public:
+		MockTestStepStartEventHandler();
+		virtual ~MockTestStepStartEventHandler();
+
+		MOCK_CONST_METHOD2(handleTestStepStart, void(const std::string&, bool));
+	};
+
+}}}
+
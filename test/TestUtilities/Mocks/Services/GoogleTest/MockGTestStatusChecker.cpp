@@ -0,0 +1,11 @@
+#include "stdafx.h"
+#include "MockGTestStatusChecker.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	MockGTestStatusChecker::MockGTestStatusChecker() = default;
+	MockGTestStatusChecker::~MockGTestStatusChecker() = default;
+
+}}}
+
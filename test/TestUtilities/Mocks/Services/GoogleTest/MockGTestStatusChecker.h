@@ -0,0 +1,18 @@
+#pragma once
+
+#include "GTestAllureUtilities/Services/GoogleTest/IGTestStatusChecker.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	class MockGTestStatusChecker : public service::IGTestStatusChecker
+	{
+	public:
+		MockGTestStatusChecker();
+		virtual ~MockGTestStatusChecker();
+
+		MOCK_CONST_METHOD0(getCurrentTestStatus, model::Status());
+	};
+
+}}}
+
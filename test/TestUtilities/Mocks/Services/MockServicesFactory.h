@@ -70,6 +70,14 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 
 		std::unique_ptr<service::ITimeService> buildTimeService() const;
 		MOCK_CONST_METHOD0(buildTimeServiceProxy, service::ITimeService*());
+
+
+		// Long-lived instances
+		MOCK_CONST_METHOD0(getGTestStatusChecker, const service::IGTestStatusChecker&());
+		MOCK_CONST_METHOD0(getTestStepStartEventHandler, const service::ITestStepStartEventHandler&());
+		MOCK_CONST_METHOD0(getTestStepEndEventHandler, const service::ITestStepEndEventHandler&());
+		MOCK_CONST_METHOD0(getTestSuitePropertySetter, const service::ITestSuitePropertySetter&());
+		MOCK_CONST_METHOD0(getTestCasePropertySetter, const service::ITestCasePropertySetter&());
 	};
 
 }}}
@@ -0,0 +1,11 @@
+#include "stdafx.h"
+#include "MockTestSuitePropertySetter.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	MockTestSuitePropertySetter::MockTestSuitePropertySetter() = default;
+	MockTestSuitePropertySetter::~MockTestSuitePropertySetter() = default;
+
+}}}
+
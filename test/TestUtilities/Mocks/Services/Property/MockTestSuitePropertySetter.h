@@ -0,0 +1,18 @@
+#pragma once
+
+#include "GTestAllureUtilities/Services/Property/ITestSuitePropertySetter.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	class MockTestSuitePropertySetter : public service::ITestSuitePropertySetter
+	{
+	public:
+		MockTestSuitePropertySetter();
+		virtual ~MockTestSuitePropertySetter();
+
+		MOCK_CONST_METHOD2(setProperty, void(const std::string&, const std::string&));
+	};
+
+}}}
+
@@ -0,0 +1,16 @@
+#include "stdafx.h"
+#include "MockAllure2TestResultJSONSerializer.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	MockAllure2TestResultJSONSerializer::MockAllure2TestResultJSONSerializer() = default;
+	MockAllure2TestResultJSONSerializer::~MockAllure2TestResultJSONSerializer() = default;
+
+	void MockAllure2TestResultJSONSerializer::serialize(const service::Allure2TestResult& result, std::string& output) const
+	{
+		output = serialize(result);
+	}
+
+}}}
+
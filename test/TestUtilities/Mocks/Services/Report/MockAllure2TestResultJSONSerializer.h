@@ -0,0 +1,20 @@
+#pragma once
+
+#include "GTestAllureUtilities/Services/Report/Allure2TestResult.h"
+#include "GTestAllureUtilities/Services/Report/IAllure2TestResultJSONSerializer.h"
+
+
+namespace systelab { namespace gtest_allure { namespace test_utility {
+
+	class MockAllure2TestResultJSONSerializer : public service::IAllure2TestResultJSONSerializer
+	{
+	public:
+		MockAllure2TestResultJSONSerializer();
+		virtual ~MockAllure2TestResultJSONSerializer();
+
+		MOCK_CONST_METHOD1(serialize, std::string(const service::Allure2TestResult&));
+		void serialize(const service::Allure2TestResult&, std::string& output) const override;
+	};
+
+}}}
+
@@ -13,6 +13,7 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 		virtual ~MockTestProgramJSONBuilder();
 
 		MOCK_CONST_METHOD1(buildJSONFiles, void(const model::TestProgram&));
+		MOCK_CONST_METHOD2(buildJSONFile, void(const model::TestProgram&, const model::TestSuite&));
 	};
 
 }}}
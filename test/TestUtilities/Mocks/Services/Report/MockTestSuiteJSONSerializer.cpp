@@ -7,5 +7,10 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 	MockTestSuiteJSONSerializer::MockTestSuiteJSONSerializer() = default;
 	MockTestSuiteJSONSerializer::~MockTestSuiteJSONSerializer() = default;
 
+	void MockTestSuiteJSONSerializer::serialize(const model::TestSuite& testSuite, std::string& output) const
+	{
+		output = serialize(testSuite);
+	}
+
 }}}
 
@@ -13,6 +13,7 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 		virtual ~MockTestSuiteJSONSerializer();
 
 		MOCK_CONST_METHOD1(serialize, std::string(const model::TestSuite&));
+		void serialize(const model::TestSuite&, std::string& output) const override;
 	};
 
 }}}
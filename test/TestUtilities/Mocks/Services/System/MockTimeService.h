@@ -12,6 +12,8 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 		virtual ~MockTimeService();
 
 		MOCK_CONST_METHOD0(getCurrentTime, time_t());
+		MOCK_CONST_METHOD0(getCurrentTimeMs, int64_t());
+		MOCK_CONST_METHOD0(getCurrentTimeNs, int64_t());
 	};
 
 }}}
@@ -51,6 +51,12 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 		ON_CALL(*this, buildUUIDGeneratorServiceProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildUUIDGeneratorServiceStub));
 		ON_CALL(*this, buildFileServiceProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildFileServiceStub));
 		ON_CALL(*this, buildTimeServiceProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildTimeServiceStub));
+
+		ON_CALL(*this, getGTestStatusChecker()).WillByDefault(Invoke(this, &StubServicesFactory::getGTestStatusCheckerStub));
+		ON_CALL(*this, getTestStepStartEventHandler()).WillByDefault(Invoke(this, &StubServicesFactory::getTestStepStartEventHandlerStub));
+		ON_CALL(*this, getTestStepEndEventHandler()).WillByDefault(Invoke(this, &StubServicesFactory::getTestStepEndEventHandlerStub));
+		ON_CALL(*this, getTestSuitePropertySetter()).WillByDefault(Invoke(this, &StubServicesFactory::getTestSuitePropertySetterStub));
+		ON_CALL(*this, getTestCasePropertySetter()).WillByDefault(Invoke(this, &StubServicesFactory::getTestCasePropertySetterStub));
 	}
 
 	StubServicesFactory::~StubServicesFactory() = default;
@@ -117,7 +123,8 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 	service::ITestSuiteEndEventHandler* StubServicesFactory::buildTestSuiteEndEventHandlerStub() const
 	{
 		auto timeService = buildTimeService();
-		return new service::TestSuiteEndEventHandler(m_testProgram, std::move(timeService));
+		auto testProgramJSONBuilder = buildTestProgramJSONBuilder();
+		return new service::TestSuiteEndEventHandler(m_testProgram, std::move(timeService), std::move(testProgramJSONBuilder));
 	}
 
 	service::ITestProgramEndEventHandler* StubServicesFactory::buildTestProgramEndEventHandlerStub() const
@@ -170,5 +177,57 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 		return new service::TimeService();
 	}
 
+
+	// Long-lived instances
+	const service::IGTestStatusChecker& StubServicesFactory::getGTestStatusCheckerStub() const
+	{
+		if (!m_gtestStatusChecker)
+		{
+			m_gtestStatusChecker = buildGTestStatusChecker();
+		}
+
+		return *m_gtestStatusChecker;
+	}
+
+	const service::ITestStepStartEventHandler& StubServicesFactory::getTestStepStartEventHandlerStub() const
+	{
+		if (!m_testStepStartEventHandler)
+		{
+			m_testStepStartEventHandler = buildTestStepStartEventHandler();
+		}
+
+		return *m_testStepStartEventHandler;
+	}
+
+	const service::ITestStepEndEventHandler& StubServicesFactory::getTestStepEndEventHandlerStub() const
+	{
+		if (!m_testStepEndEventHandler)
+		{
+			m_testStepEndEventHandler = buildTestStepEndEventHandler();
+		}
+
+		return *m_testStepEndEventHandler;
+	}
+
+	const service::ITestSuitePropertySetter& StubServicesFactory::getTestSuitePropertySetterStub() const
+	{
+		if (!m_testSuitePropertySetter)
+		{
+			m_testSuitePropertySetter = buildTestSuitePropertySetter();
+		}
+
+		return *m_testSuitePropertySetter;
+	}
+
+	const service::ITestCasePropertySetter& StubServicesFactory::getTestCasePropertySetterStub() const
+	{
+		if (!m_testCasePropertySetter)
+		{
+			m_testCasePropertySetter = buildTestCasePropertySetter();
+		}
+
+		return *m_testCasePropertySetter;
+	}
+
 }}}
 
@@ -39,8 +39,21 @@ namespace systelab { namespace gtest_allure { namespace test_utility {
 		service::IFileService* buildFileServiceStub() const;
 		service::ITimeService* buildTimeServiceStub() const;
 
+		// Long-lived instances (built on first use)
+		const service::IGTestStatusChecker& getGTestStatusCheckerStub() const;
+		const service::ITestStepStartEventHandler& getTestStepStartEventHandlerStub() const;
+		const service::ITestStepEndEventHandler& getTestStepEndEventHandlerStub() const;
+		const service::ITestSuitePropertySetter& getTestSuitePropertySetterStub() const;
+		const service::ITestCasePropertySetter& getTestCasePropertySetterStub() const;
+
 	private:
 		model::TestProgram& m_testProgram;
+
+		mutable std::unique_ptr<service::IGTestStatusChecker> m_gtestStatusChecker;
+		mutable std::unique_ptr<service::ITestStepStartEventHandler> m_testStepStartEventHandler;
+		mutable std::unique_ptr<service::ITestStepEndEventHandler> m_testStepEndEventHandler;
+		mutable std::unique_ptr<service::ITestSuitePropertySetter> m_testSuitePropertySetter;
+		mutable std::unique_ptr<service::ITestCasePropertySetter> m_testCasePropertySetter;
 	};
 
 }}}
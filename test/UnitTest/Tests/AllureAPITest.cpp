@@ -0,0 +1,520 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/AllureAPI.h"
+
+#include "GTestAllureUtilities/Model/TestProperty.h"
+#include "GTestAllureUtilities/Services/ServicesFactory.h"
+#include "GTestAllureUtilities/Services/System/OutputFolder.h"
+
+#include "TestUtilities/Mocks/Services/MockServicesFactory.h"
+#include "TestUtilities/Mocks/Services/EventHandlers/MockTestStepEndEventHandler.h"
+#include "TestUtilities/Mocks/Services/EventHandlers/MockTestStepStartEventHandler.h"
+#include "TestUtilities/Mocks/Services/GoogleTest/MockGTestStatusChecker.h"
+#include "TestUtilities/Mocks/Services/Property/MockTestSuitePropertySetter.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+using namespace systelab::gtest_allure::test_utility;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class AllureAPITest : public Test
+	{
+	public:
+		void SetUp()
+		{
+			ON_CALL(m_gtestStatusChecker, getCurrentTestStatus()).WillByDefault(Return(model::Status::PASSED));
+
+			auto servicesFactory = std::make_unique<MockServicesFactory>();
+			ON_CALL(*servicesFactory, getTestStepStartEventHandler()).WillByDefault(ReturnRef(m_testStepStartEventHandler));
+			ON_CALL(*servicesFactory, getTestStepEndEventHandler()).WillByDefault(ReturnRef(m_testStepEndEventHandler));
+			ON_CALL(*servicesFactory, getGTestStatusChecker()).WillByDefault(ReturnRef(m_gtestStatusChecker));
+			ON_CALL(*servicesFactory, getTestSuitePropertySetter()).WillByDefault(ReturnRef(m_testSuitePropertySetter));
+			service::ServicesFactory::setInstance(std::move(servicesFactory));
+
+			AllureAPI::releaseTestCaseData();
+		}
+
+		void TearDown()
+		{
+			AllureAPI::releaseTestCaseData();
+			service::ServicesFactory::setInstance(nullptr);
+		}
+
+	protected:
+		MockTestStepStartEventHandler m_testStepStartEventHandler;
+		MockTestStepEndEventHandler m_testStepEndEventHandler;
+		MockGTestStatusChecker m_gtestStatusChecker;
+		MockTestSuitePropertySetter m_testSuitePropertySetter;
+	};
+
+
+	// Steps
+	TEST_F(AllureAPITest, testAddActionReportsPassedActionStep)
+	{
+		EXPECT_CALL(m_testStepStartEventHandler, handleTestStepStart("Action", true));
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::PASSED));
+
+		AllureAPI::addAction("Action", []() {});
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("Action", AllureAPI::getSteps()[0].name);
+		EXPECT_EQ("passed", AllureAPI::getSteps()[0].status);
+		EXPECT_EQ(0u, AllureAPI::getSteps()[0].nestedStepsCount);
+	}
+
+	TEST_F(AllureAPITest, testAddExpectedResultReportsPassedExpectedResultStep)
+	{
+		EXPECT_CALL(m_testStepStartEventHandler, handleTestStepStart("Expected result", false));
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::PASSED));
+
+		AllureAPI::addExpectedResult("Expected result", []() {});
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("passed", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testAddActionReportsCurrentTestStatusOnStepEnd)
+	{
+		ON_CALL(m_gtestStatusChecker, getCurrentTestStatus()).WillByDefault(Return(model::Status::FAILED));
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::FAILED));
+
+		AllureAPI::addAction("Action", []() {});
+	}
+
+	TEST_F(AllureAPITest, testAddActionThrowingMarksStepAsBrokenAndPropagatesException)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::BROKEN));
+
+		ASSERT_THROW(AllureAPI::addAction("Action", []() { throw std::runtime_error("Action error"); }), std::runtime_error);
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("broken", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testAddExpectedResultThrowingMarksStepAsBrokenAndPropagatesException)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::BROKEN));
+
+		ASSERT_THROW(AllureAPI::addExpectedResult("Expected result", []() { throw std::runtime_error("Verification error"); }),
+					 std::runtime_error);
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("broken", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testAddActionWithStdFunctionThrowingMarksStepAsBrokenAndPropagatesException)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::BROKEN));
+
+		std::function<void()> actionFunction = []() { throw std::runtime_error("Action error"); };
+		ASSERT_THROW(AllureAPI::addAction("Action", actionFunction), std::runtime_error);
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("broken", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testAddActionRethrowsStepEndErrorAndMarksStepAsBroken)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(_))
+			.WillOnce(Throw(service::ITestStepEndEventHandler::NoRunningTestStepException()));
+
+		ASSERT_THROW(AllureAPI::addAction("Action", []() {}), service::ITestStepEndEventHandler::NoRunningTestStepException);
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("broken", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testAddActionThrowingPropagatesActionExceptionWhenStepEndFails)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::BROKEN))
+			.WillOnce(Throw(service::ITestStepEndEventHandler::NoRunningTestStepException()));
+
+		ASSERT_THROW(AllureAPI::addAction("Action", []() { throw std::runtime_error("Action error"); }), std::runtime_error);
+	}
+
+
+	// StepScope
+	TEST_F(AllureAPITest, testStepScopeDestructorIsNoexcept)
+	{
+		ASSERT_TRUE(std::is_nothrow_destructible_v<AllureAPI::StepScope>);
+	}
+
+	TEST_F(AllureAPITest, testStepScopeEndRethrowsStepEndError)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(_))
+			.WillOnce(Throw(service::ITestStepEndEventHandler::NoRunningTestStepException()));
+
+		AllureAPI::StepScope step("Step");
+		ASSERT_THROW(step.end(), service::ITestStepEndEventHandler::NoRunningTestStepException);
+	}
+
+	TEST_F(AllureAPITest, testStepScopeEndCalledTwiceReportsStepEndOnce)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(_)).Times(1);
+
+		AllureAPI::StepScope step("Step");
+		step.end();
+		ASSERT_NO_THROW(step.end());
+	}
+
+	TEST_F(AllureAPITest, testStepScopeNotEndedReportsStepEndOnDestruction)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::PASSED));
+
+		{
+			AllureAPI::StepScope step("Step");
+		}
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("passed", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testStepScopeDestructorDoesNotThrowStepEndError)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(_))
+			.WillOnce(Throw(service::ITestStepEndEventHandler::NoRunningTestStepException()));
+
+		ASSERT_NO_THROW({ AllureAPI::StepScope step("Step"); });
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("broken", AllureAPI::getSteps()[0].status);
+	}
+
+	TEST_F(AllureAPITest, testStepScopeLeftByExceptionDoesNotThrowStepEndError)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::BROKEN))
+			.WillOnce(Throw(service::ITestStepEndEventHandler::NoRunningTestStepException()));
+
+		ASSERT_THROW({
+			AllureAPI::StepScope step("Step");
+			throw std::runtime_error("Step error");
+		}, std::runtime_error);
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("broken", AllureAPI::getSteps()[0].status);
+	}
+
+
+	// Nested steps
+	TEST_F(AllureAPITest, testNestedActionsAreRecordedAfterTheirParentStep)
+	{
+		{
+			InSequence sequence;
+			EXPECT_CALL(m_testStepStartEventHandler, handleTestStepStart("Outer", true));
+			EXPECT_CALL(m_testStepStartEventHandler, handleTestStepStart("Inner 1", true));
+			EXPECT_CALL(m_testStepStartEventHandler, handleTestStepStart("Inner 2", false));
+			EXPECT_CALL(m_testStepStartEventHandler, handleTestStepStart("Deep", true));
+		}
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::PASSED)).Times(4);
+
+		AllureAPI::addAction("Outer", []()
+		{
+			AllureAPI::addAction("Inner 1", []() {});
+			AllureAPI::addExpectedResult("Inner 2", []()
+			{
+				AllureAPI::addAction("Deep", []() {});
+			});
+		});
+
+		const auto& steps = AllureAPI::getSteps();
+		ASSERT_EQ(4u, steps.size());
+		EXPECT_EQ("Outer", steps[0].name);
+		EXPECT_EQ(3u, steps[0].nestedStepsCount);
+		EXPECT_EQ("Inner 1", steps[1].name);
+		EXPECT_EQ(0u, steps[1].nestedStepsCount);
+		EXPECT_EQ("Inner 2", steps[2].name);
+		EXPECT_EQ(1u, steps[2].nestedStepsCount);
+		EXPECT_EQ("Deep", steps[3].name);
+		EXPECT_EQ(0u, steps[3].nestedStepsCount);
+	}
+
+	TEST_F(AllureAPITest, testAttachmentsAreAddedToInnermostRunningStep)
+	{
+		AllureAPI::addAction("Outer", []()
+		{
+			AllureAPI::addAction("Inner", []()
+			{
+				AllureAPI::addAttachment("Inner log", "text/plain", "inner.txt");
+			});
+			AllureAPI::addAttachment("Outer log", "text/plain", "outer.txt");
+		});
+
+		const auto& steps = AllureAPI::getSteps();
+		ASSERT_EQ(2u, steps.size());
+		ASSERT_EQ(1u, steps[0].attachments.size());
+		EXPECT_EQ("outer.txt", steps[0].attachments[0].source);
+		ASSERT_EQ(1u, steps[1].attachments.size());
+		EXPECT_EQ("inner.txt", steps[1].attachments[0].source);
+		EXPECT_TRUE(AllureAPI::getAttachments().empty());
+	}
+
+	TEST_F(AllureAPITest, testStepScopeEndedBeforeNestedStepFinishesNestedStepAsBroken)
+	{
+		{
+			InSequence sequence;
+			EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::BROKEN));
+			EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(model::Status::PASSED));
+		}
+
+		AllureAPI::StepScope outerStep("Outer");
+		AllureAPI::StepScope innerStep("Inner");
+		outerStep.end();
+		innerStep.end();
+
+		const auto& steps = AllureAPI::getSteps();
+		ASSERT_EQ(2u, steps.size());
+		EXPECT_EQ("passed", steps[0].status);
+		EXPECT_EQ(1u, steps[0].nestedStepsCount);
+		EXPECT_EQ("broken", steps[1].status);
+	}
+
+	TEST_F(AllureAPITest, testStepScopeEndedBeforeNestedStepLeavesNoRunningStep)
+	{
+		AllureAPI::StepScope outerStep("Outer");
+		AllureAPI::StepScope innerStep("Inner");
+		outerStep.end();
+
+		AllureAPI::addAttachment("Log", "text/plain", "log.txt");
+
+		ASSERT_EQ(1u, AllureAPI::getAttachments().size());
+		EXPECT_TRUE(AllureAPI::getSteps()[0].attachments.empty());
+		EXPECT_TRUE(AllureAPI::getSteps()[1].attachments.empty());
+	}
+
+	TEST_F(AllureAPITest, testStepScopeEndedAfterTestCaseDataReleasedDoesNotReportStepEnd)
+	{
+		EXPECT_CALL(m_testStepEndEventHandler, handleTestStepEnd(_)).Times(1);
+
+		AllureAPI::StepScope releasedStep("Released");
+		AllureAPI::releaseTestCaseData();
+
+		AllureAPI::StepScope step("Step");
+		releasedStep.end();
+
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		EXPECT_EQ("", AllureAPI::getSteps()[0].status);
+
+		step.end();
+		EXPECT_EQ("passed", AllureAPI::getSteps()[0].status);
+	}
+
+
+	// Configuration
+	TEST_F(AllureAPITest, testConfigurationSetByAnotherThreadIsReadOnceSet)
+	{
+		size_t previousCapacity = AllureAPI::getAsyncResultsQueueCapacity();
+
+		std::thread([]() { AllureAPI::setAsyncResultsQueueCapacity(123); }).join();
+		size_t capacity = AllureAPI::getAsyncResultsQueueCapacity();
+		AllureAPI::setAsyncResultsQueueCapacity(previousCapacity);
+
+		ASSERT_EQ(123u, capacity);
+	}
+
+	TEST_F(AllureAPITest, testConfigurationSnapshotIsKeptUnchangedAfterConfigurationChanges)
+	{
+		size_t previousCapacity = AllureAPI::getAsyncResultsQueueCapacity();
+		auto configuration = AllureAPI::getConfiguration();
+
+		AllureAPI::setAsyncResultsQueueCapacity(previousCapacity + 1);
+		auto newConfiguration = AllureAPI::getConfiguration();
+		AllureAPI::setAsyncResultsQueueCapacity(previousCapacity);
+
+		ASSERT_EQ(previousCapacity, configuration->asyncResultsQueueCapacity);
+		ASSERT_EQ(previousCapacity + 1, newConfiguration->asyncResultsQueueCapacity);
+		ASSERT_LT(configuration->version, newConfiguration->version);
+	}
+
+	TEST_F(AllureAPITest, testBeginTestSuiteForgetsSuiteNameGivenToPreviousSuite)
+	{
+		EXPECT_CALL(m_testSuitePropertySetter, setProperty(model::test_property::NAME_PROPERTY, "CustomSuite"));
+
+		AllureAPI::setTestSuiteName("CustomSuite");
+		AllureAPI::endTestCase();
+		std::string customSuiteName = AllureAPI::getConfiguration()->getSuiteName("GTestSuite");
+
+		AllureAPI::beginTestSuite();
+		std::string nextSuiteName = AllureAPI::getConfiguration()->getSuiteName("NextGTestSuite");
+
+		ASSERT_EQ("CustomSuite", customSuiteName);
+		ASSERT_EQ("NextGTestSuite", nextSuiteName);
+	}
+
+
+	class AllureAPIAttachmentStreamTest : public AllureAPITest
+	{
+	public:
+		void SetUp()
+		{
+			AllureAPITest::SetUp();
+
+			m_previousOutputFolder = AllureAPI::getOutputFolder();
+			m_previousTestProgramOutputFolder = AllureAPI::getTestProgram().getOutputFolder();
+
+			m_outputFolder = "AllureAPIAttachmentStreamTest";
+			std::filesystem::remove_all(m_outputFolder);
+			AllureAPI::setOutputFolder(m_outputFolder);
+		}
+
+		void TearDown()
+		{
+			try
+			{
+				AllureAPI::flushAttachments();
+			}
+			catch (...)
+			{
+			}
+
+			AllureAPI::setOutputFolder(m_previousOutputFolder);
+			AllureAPI::getTestProgram().setOutputFolder(m_previousTestProgramOutputFolder);
+			std::filesystem::remove_all(m_outputFolder);
+
+			AllureAPITest::TearDown();
+		}
+
+		std::filesystem::path getAttachmentFilePath(const AllureAPI::Attachment& attachment)
+		{
+			return std::filesystem::path(m_outputFolder) / attachment.source;
+		}
+
+		std::string readAttachmentFile(const AllureAPI::Attachment& attachment)
+		{
+			std::ifstream fileStream(getAttachmentFilePath(attachment), std::ios::binary);
+			std::stringstream buffer;
+			buffer << fileStream.rdbuf();
+			return buffer.str();
+		}
+
+		std::string buildContent(size_t size)
+		{
+			std::string content(size, '\0');
+			for (size_t i = 0; i < size; i++)
+			{
+				content[i] = (char) (i % 251);
+			}
+
+			return content;
+		}
+
+	protected:
+		std::string m_outputFolder;
+		std::string m_previousOutputFolder;
+		std::string m_previousTestProgramOutputFolder;
+	};
+
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamSavesWrittenContentOnceClosed)
+	{
+		AllureAPI::AttachmentStream stream("Log", "text/plain");
+		stream.write(std::string_view("First line\n")).write(std::string_view("Second line\n"));
+		stream.close();
+		AllureAPI::flushAttachments();
+
+		ASSERT_EQ(1u, AllureAPI::getAttachments().size());
+		const auto& attachment = AllureAPI::getAttachments()[0];
+		EXPECT_EQ("Log", attachment.name);
+		EXPECT_EQ("text/plain", attachment.type);
+		EXPECT_EQ("-attachment.txt", attachment.source.substr(attachment.source.size() - 15));
+		EXPECT_EQ("First line\nSecond line\n", readAttachmentFile(attachment));
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamSavesContentOfWriteLargerThanChunkSize)
+	{
+		std::string content = buildContent(3 * 64 * 1024 + 123);
+
+		{
+			AllureAPI::AttachmentStream stream("Log", "text/plain");
+			stream.write(std::string_view(content));
+		}
+		AllureAPI::flushAttachments();
+
+		ASSERT_EQ(1u, AllureAPI::getAttachments().size());
+		ASSERT_EQ(content, readAttachmentFile(AllureAPI::getAttachments()[0]));
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamSavesContentOfWritesCrossingChunkSizeInOrder)
+	{
+		std::string content = buildContent(150 * 1000);
+
+		{
+			AllureAPI::AttachmentStream stream("Log", "text/plain");
+			for (size_t offset = 0; offset < content.size(); offset += 1000)
+			{
+				stream.write(std::string_view(content).substr(offset, 1000));
+			}
+		}
+		AllureAPI::flushAttachments();
+
+		ASSERT_EQ(1u, AllureAPI::getAttachments().size());
+		ASSERT_EQ(content, readAttachmentFile(AllureAPI::getAttachments()[0]));
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamWithoutContentCreatesEmptyFile)
+	{
+		{
+			AllureAPI::AttachmentStream stream("Log", "text/plain");
+		}
+		AllureAPI::flushAttachments();
+
+		ASSERT_EQ(1u, AllureAPI::getAttachments().size());
+		ASSERT_TRUE(std::filesystem::exists(getAttachmentFilePath(AllureAPI::getAttachments()[0])));
+		ASSERT_EQ(0u, std::filesystem::file_size(getAttachmentFilePath(AllureAPI::getAttachments()[0])));
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamClosedTwiceKeepsSavedContent)
+	{
+		{
+			AllureAPI::AttachmentStream stream("Log", "text/plain");
+			stream.write(std::string_view("Content"));
+			stream.close();
+			ASSERT_NO_THROW(stream.close());
+		}
+		AllureAPI::flushAttachments();
+
+		ASSERT_EQ(1u, AllureAPI::getAttachments().size());
+		ASSERT_EQ("Content", readAttachmentFile(AllureAPI::getAttachments()[0]));
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamIsAddedToRunningStep)
+	{
+		{
+			AllureAPI::StepScope step("Step");
+			AllureAPI::AttachmentStream stream("Log", "text/plain");
+		}
+
+		ASSERT_TRUE(AllureAPI::getAttachments().empty());
+		ASSERT_EQ(1u, AllureAPI::getSteps().size());
+		ASSERT_EQ(1u, AllureAPI::getSteps()[0].attachments.size());
+		ASSERT_EQ("Log", AllureAPI::getSteps()[0].attachments[0].name);
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamDestructorIsNoexcept)
+	{
+		ASSERT_TRUE(std::is_nothrow_destructible_v<AllureAPI::AttachmentStream>);
+	}
+
+	TEST_F(AllureAPIAttachmentStreamTest, testAttachmentStreamDestructorDoesNotThrowWhenUnableToSaveFile)
+	{
+		std::filesystem::create_directories(m_outputFolder);
+		std::string notAFolder = m_outputFolder + "/NotAFolder.txt";
+		std::ofstream(notAFolder) << "Regular file";
+		AllureAPI::setOutputFolder(notAFolder + "/Subfolder");
+
+		ASSERT_NO_THROW({
+			AllureAPI::AttachmentStream stream("Log", "text/plain");
+			stream.write(std::string_view("Content"));
+		});
+
+		ASSERT_THROW(AllureAPI::flushAttachments(), service::OutputFolder::UnableToOpenFolderException);
+	}
+
+}}}
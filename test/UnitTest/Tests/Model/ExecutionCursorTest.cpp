@@ -0,0 +1,96 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Model/ExecutionCursor.h"
+
+#include "Model/Step.h"
+
+#include <vector>
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class ExecutionCursorTest : public Test
+	{
+	public:
+		void addStep(const std::string& name, model::Stage stage)
+		{
+			model::Step step;
+			step.setName(name);
+			step.setStage(stage);
+			m_steps.push_back(step);
+			m_cursor.onItemAdded(m_steps);
+		}
+
+	protected:
+		model::ExecutionCursor m_cursor;
+		std::vector<model::Step> m_steps;
+	};
+
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemReturnsNullForEmptyContainer)
+	{
+		ASSERT_EQ(nullptr, m_cursor.getRunningItem(m_steps));
+	}
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemReturnsLastAddedRunningItem)
+	{
+		addStep("Finished step", model::Stage::FINISHED);
+		addStep("Running step", model::Stage::RUNNING);
+
+		model::Step* runningStep = m_cursor.getRunningItem(m_steps);
+		ASSERT_EQ(&m_steps[1], runningStep);
+	}
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemReturnsNullWhenNoItemRunning)
+	{
+		addStep("Finished step 1", model::Stage::FINISHED);
+		addStep("Finished step 2", model::Stage::FINISHED);
+
+		ASSERT_EQ(nullptr, m_cursor.getRunningItem(m_steps));
+	}
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemReturnsParentItemAgainWhenNestedItemFinishes)
+	{
+		addStep("Parent step", model::Stage::RUNNING);
+		addStep("Nested step", model::Stage::RUNNING);
+		ASSERT_EQ(&m_steps[1], m_cursor.getRunningItem(m_steps));
+
+		m_steps[1].setStage(model::Stage::FINISHED);
+
+		ASSERT_EQ(&m_steps[0], m_cursor.getRunningItem(m_steps));
+	}
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemFindsItemSetRunningWithoutNotifyingCursor)
+	{
+		addStep("Step 1", model::Stage::FINISHED);
+		addStep("Step 2", model::Stage::FINISHED);
+		ASSERT_EQ(nullptr, m_cursor.getRunningItem(m_steps));
+
+		m_steps[0].setStage(model::Stage::RUNNING);
+
+		ASSERT_EQ(&m_steps[0], m_cursor.getRunningItem(m_steps));
+	}
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemReturnsNullAfterContainerCleared)
+	{
+		addStep("Running step", model::Stage::RUNNING);
+		m_steps.clear();
+
+		ASSERT_EQ(nullptr, m_cursor.getRunningItem(m_steps));
+
+		addStep("New running step", model::Stage::RUNNING);
+		ASSERT_EQ(&m_steps[0], m_cursor.getRunningItem(m_steps));
+	}
+
+	TEST_F(ExecutionCursorTest, testGetRunningItemOfConstContainerReturnsConstItem)
+	{
+		addStep("Running step", model::Stage::RUNNING);
+
+		const std::vector<model::Step>& steps = m_steps;
+		const model::Step* runningStep = m_cursor.getRunningItem(steps);
+		ASSERT_EQ(&m_steps[0], runningStep);
+	}
+
+}}}
@@ -0,0 +1,96 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Model/LinkTemplate.h"
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class LinkTemplateTest : public Test
+	{
+	protected:
+		model::LinkTemplate::Values m_values { "TC-1234", "MySuite" };
+	};
+
+
+	TEST_F(LinkTemplateTest, testRenderReplacesEmptyPlaceholderByIdentifier)
+	{
+		model::LinkTemplate linkTemplate("http://tms/{}");
+
+		ASSERT_TRUE(linkTemplate.hasPlaceholders());
+		ASSERT_EQ("http://tms/TC-1234", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderReplacesIdAndSuitePlaceholders)
+	{
+		model::LinkTemplate linkTemplate("http://tms/{suite}/cases/{id}");
+
+		ASSERT_EQ("http://tms/MySuite/cases/TC-1234", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderReplacesEveryOccurrenceOfRepeatedPlaceholder)
+	{
+		model::LinkTemplate linkTemplate("{id}-{}-{id}/{suite}{suite}");
+
+		ASSERT_EQ("TC-1234-TC-1234-TC-1234/MySuiteMySuite", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderKeepsUnknownPlaceholdersAsLiteralText)
+	{
+		model::LinkTemplate linkTemplate("http://tms/{project}/{ID}/{id}/{");
+
+		ASSERT_EQ("http://tms/{project}/{ID}/TC-1234/{", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderReplacesPlaceholderFollowingAnOpeningBrace)
+	{
+		model::LinkTemplate linkTemplate("http://tms/{{id}}");
+
+		ASSERT_EQ("http://tms/{TC-1234}", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderReturnsPatternWithoutPlaceholdersUnchanged)
+	{
+		model::LinkTemplate linkTemplate("http://tms/fixed");
+
+		ASSERT_FALSE(linkTemplate.hasPlaceholders());
+		ASSERT_EQ("http://tms/fixed", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderEmptyTemplateReturnsEmptyString)
+	{
+		model::LinkTemplate linkTemplate;
+
+		ASSERT_TRUE(linkTemplate.isEmpty());
+		ASSERT_FALSE(linkTemplate.hasPlaceholders());
+		ASSERT_EQ("", linkTemplate.render(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testGetRenderedSizeMatchesRenderedLinkSize)
+	{
+		model::LinkTemplate linkTemplate("http://tms/{suite}/{id}?x={");
+
+		ASSERT_EQ(linkTemplate.render(m_values).size(), linkTemplate.getRenderedSize(m_values));
+	}
+
+	TEST_F(LinkTemplateTest, testRenderIntoBufferAppendsToExistingContent)
+	{
+		model::LinkTemplate linkTemplate("/{id}");
+
+		std::string output = "http://tms";
+		linkTemplate.render(m_values, output);
+
+		ASSERT_EQ("http://tms/TC-1234", output);
+	}
+
+	TEST_F(LinkTemplateTest, testCopiedTemplateRendersSameLink)
+	{
+		model::LinkTemplate linkTemplate("http://tms/{suite}/{id}");
+		model::LinkTemplate copiedLinkTemplate(linkTemplate);
+
+		ASSERT_EQ(linkTemplate, copiedLinkTemplate);
+		ASSERT_EQ(linkTemplate.render(m_values), copiedLinkTemplate.render(m_values));
+	}
+
+}}}
@@ -0,0 +1,112 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Model/TestProgram.h"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class TestProgramTest : public Test
+	{
+	public:
+		void SetUp()
+		{
+			m_testProgram.setName("MyTestProgram");
+			for (unsigned int i = 0; i < 3; i++)
+			{
+				model::TestSuite& testSuite = m_testProgram.emplaceTestSuite("UUID" + std::to_string(i), "Suite" + std::to_string(i), 1000);
+				testSuite.emplaceTestCase("testCase", 1001).addTag("Tag of suite " + std::to_string(i));
+			}
+		}
+
+		std::string buildStepName(unsigned int thread, unsigned int step)
+		{
+			// Long enough not to fit into the small string buffer, so it is allocated from the arena
+			return "Step " + std::to_string(step) + " recorded by thread " + std::to_string(thread) + " of the test program";
+		}
+
+	protected:
+		model::TestProgram m_testProgram;
+	};
+
+
+	TEST_F(TestProgramTest, testStepsRecordedFromSeveralThreadsAtOnceAreKept)
+	{
+		const unsigned int nThreads = 8;
+		const unsigned int nSteps = 500;
+
+		model::TestSuite& testSuite = m_testProgram.getTestSuite(0);
+		for (unsigned int i = 1; i < nThreads; i++)
+		{
+			testSuite.emplaceTestCase("testCase" + std::to_string(i), 1001);
+		}
+
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < nThreads; i++)
+		{
+			threads.emplace_back([this, i, &testSuite]()
+			{
+				model::TestCase& testCase = testSuite.getTestCases()[i];
+				for (unsigned int j = 0; j < nSteps; j++)
+				{
+					testCase.emplaceStep(model::StepType::ACTION_STEP, buildStepName(i, j), 2000 + j);
+					testCase.addTag(buildStepName(i, j));
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		for (unsigned int i = 0; i < nThreads; i++)
+		{
+			const model::TestCase& testCase = testSuite.getTestCases()[i];
+			ASSERT_EQ(nSteps, testCase.getStepCount());
+			for (unsigned int j = 0; j < nSteps; j++)
+			{
+				ASSERT_EQ(buildStepName(i, j), testCase.getStep(j)->getName());
+			}
+		}
+	}
+
+	TEST_F(TestProgramTest, testMoveConstructionKeepsTestSuites)
+	{
+		model::TestProgram expectedTestProgram(m_testProgram);
+
+		model::TestProgram movedTestProgram(std::move(m_testProgram));
+
+		ASSERT_EQ(expectedTestProgram, movedTestProgram);
+		ASSERT_EQ(3, movedTestProgram.getTestSuitesCount());
+		ASSERT_EQ("Suite2", movedTestProgram.getTestSuite(2).getName());
+		ASSERT_EQ(0, m_testProgram.getTestSuitesCount());
+	}
+
+	TEST_F(TestProgramTest, testMoveAssignmentKeepsTestSuites)
+	{
+		model::TestProgram expectedTestProgram(m_testProgram);
+
+		model::TestProgram movedTestProgram;
+		movedTestProgram.emplaceTestSuite("PreviousUUID", "PreviousSuite", 1);
+		movedTestProgram = std::move(m_testProgram);
+
+		ASSERT_EQ(expectedTestProgram, movedTestProgram);
+		ASSERT_EQ(3, movedTestProgram.getTestSuitesCount());
+		ASSERT_EQ(0, m_testProgram.getTestSuitesCount());
+	}
+
+	TEST_F(TestProgramTest, testRunningTestSuiteIsFoundAfterMove)
+	{
+		model::TestProgram movedTestProgram(std::move(m_testProgram));
+
+		ASSERT_EQ(&movedTestProgram.getTestSuite(2), movedTestProgram.getRunningTestSuite());
+	}
+
+}}}
@@ -0,0 +1,112 @@
+#include "stdafx.h"
+#include "RapidJSONAdapter/JSONAdapter.h"
+
+#include "JSONAdapterInterface/IJSONDocument.h"
+#include "JSONAdapterInterface/IJSONValue.h"
+
+#include <vector>
+
+
+using namespace testing;
+using namespace systelab::json;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class JSONDocumentTest : public Test
+	{
+	public:
+		std::unique_ptr<IJSONDocument> buildArrayOfObjectsDocument(unsigned int nObjects)
+		{
+			auto jsonDocument = m_jsonAdapter.buildEmptyDocument();
+			auto& jsonRoot = jsonDocument->getRootValue();
+			jsonRoot.setType(OBJECT_TYPE);
+
+			// Values are all built before being attached, so that every attach looks up
+			// a registry holding the values still pending
+			std::vector< std::unique_ptr<IJSONValue> > jsonObjects;
+			for (unsigned int i = 0; i < nObjects; i++)
+			{
+				auto jsonObject = jsonRoot.buildValue(OBJECT_TYPE);
+				jsonObject->addMember("index", static_cast<int>(i));
+				jsonObjects.push_back(std::move(jsonObject));
+			}
+
+			auto jsonArray = jsonRoot.buildValue(ARRAY_TYPE);
+			for (auto& jsonObject : jsonObjects)
+			{
+				jsonArray->addArrayValue(std::move(jsonObject));
+			}
+			jsonRoot.addMember("items", std::move(jsonArray));
+
+			return jsonDocument;
+		}
+
+	protected:
+		systelab::json::rapidjson::JSONAdapter m_jsonAdapter;
+	};
+
+
+	TEST_F(JSONDocumentTest, testAddArrayValuesKeepsValuesInInsertionOrder)
+	{
+		auto jsonDocument = buildArrayOfObjectsDocument(3);
+
+		ASSERT_EQ("{\"items\":[{\"index\":0},{\"index\":1},{\"index\":2}]}", jsonDocument->serialize());
+	}
+
+	TEST_F(JSONDocumentTest, testAddArrayValueThrowsExceptionForValueOfAnotherDocument)
+	{
+		auto jsonDocument = m_jsonAdapter.buildEmptyDocument();
+		auto& jsonRoot = jsonDocument->getRootValue();
+		jsonRoot.setType(ARRAY_TYPE);
+
+		auto otherJSONDocument = m_jsonAdapter.buildEmptyDocument();
+		auto otherJSONValue = otherJSONDocument->getRootValue().buildValue(OBJECT_TYPE);
+
+		ASSERT_THROW(jsonRoot.addArrayValue(std::move(otherJSONValue)), std::runtime_error);
+	}
+
+	TEST_F(JSONDocumentTest, testSerializeIntoBufferReplacesPreviousContents)
+	{
+		auto jsonDocument = buildArrayOfObjectsDocument(2);
+
+		std::string output = "previous contents";
+		jsonDocument->serialize(output);
+
+		ASSERT_EQ(jsonDocument->serialize(), output);
+	}
+
+	TEST_F(JSONDocumentTest, testAddArrayValuesInReverseBuildOrderAttachesEachValueOnce)
+	{
+		auto jsonDocument = m_jsonAdapter.buildEmptyDocument();
+		auto& jsonRoot = jsonDocument->getRootValue();
+		jsonRoot.setType(ARRAY_TYPE);
+
+		std::vector< std::unique_ptr<IJSONValue> > jsonObjects;
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			auto jsonObject = jsonRoot.buildValue(OBJECT_TYPE);
+			jsonObject->addMember("index", static_cast<int>(i));
+			jsonObjects.push_back(std::move(jsonObject));
+		}
+
+		for (auto it = jsonObjects.rbegin(); it != jsonObjects.rend(); ++it)
+		{
+			jsonRoot.addArrayValue(std::move(*it));
+		}
+
+		ASSERT_EQ("[{\"index\":2},{\"index\":1},{\"index\":0}]", jsonDocument->serialize());
+	}
+
+	TEST_F(JSONDocumentTest, testAddArrayValuesBuiltBeforehandKeepsAllValuesInOrder)
+	{
+		auto jsonDocument = buildArrayOfObjectsDocument(1000);
+		auto& jsonItems = jsonDocument->getRootValue().getObjectMemberValue("items");
+
+		ASSERT_EQ(1000u, jsonItems.getArrayValueCount());
+		for (unsigned int i = 0; i < 1000; i++)
+		{
+			ASSERT_EQ(static_cast<int>(i), jsonItems.getArrayValue(i).getObjectMemberValue("index").getInteger());
+		}
+	}
+
+}}}
@@ -57,7 +57,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			m_timeService = timeService.get();
 
 			m_currentTime = 123456789;
-			ON_CALL(*m_timeService, getCurrentTime()).WillByDefault(Return(m_currentTime));
+			ON_CALL(*m_timeService, getCurrentTimeMs()).WillByDefault(Return(m_currentTime));
 
 			return timeService;
 		}
@@ -68,7 +68,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		MockTimeService* m_timeService;
 
 		model::TestCase* m_runningTestCase;
-		time_t m_currentTime;
+		int64_t m_currentTime;
 	};
 
 
@@ -2,7 +2,7 @@
 #include "GTestAllureUtilities/Services/EventHandlers/TestStepEndEventHandler.h"
 
 #include "Model/TestProgram.h"
-#include "Model/Action.h"
+#include "Model/Step.h"
 
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 #include "TestUtilities/Mocks/Services/System/MockUUIDGeneratorService.h"
@@ -31,7 +31,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			m_timeService = timeService.get();
 
 			m_currentTime = 123456789;
-			ON_CALL(*m_timeService, getCurrentTime()).WillByDefault(Return(m_currentTime));
+			ON_CALL(*m_timeService, getCurrentTimeMs()).WillByDefault(Return(m_currentTime));
 
 			return timeService;
 		}
@@ -70,13 +70,13 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			return testCase;
 		}
 
-		std::unique_ptr<model::Step> buildTestCaseStep(const std::string& name, model::Stage stage)
+		model::Step buildTestCaseStep(const std::string& name, model::Stage stage)
 		{
-			auto step = std::make_unique<model::Action>();
-			step->setName(name);
-			step->setStart(m_timeService->getCurrentTime());
-			step->setStage(stage);
-			step->setStatus(model::Status::UNKNOWN);
+			model::Step step(model::StepType::ACTION_STEP);
+			step.setName(name);
+			step.setStart(m_timeService->getCurrentTimeMs());
+			step.setStage(stage);
+			step.setStatus(model::Status::UNKNOWN);
 
 			return step;
 		}
@@ -87,7 +87,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		MockTimeService* m_timeService;
 
 		model::Step* m_runningTestStep;
-		time_t m_currentTime;
+		int64_t m_currentTime;
 	};
 
 
@@ -103,6 +103,23 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_EQ(model::Stage::FINISHED, m_runningTestStep->getStage());
 	}
 
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndFinishesMostRecentlyStartedStepWhenStepsAreNested)
+	{
+		auto& runningTestCase = m_testProgram.getTestSuite(1).getTestCases()[1];
+		runningTestCase.addStep(buildTestCaseStep("TC-2.2-NestedAction", model::Stage::RUNNING));
+		model::Step* nestedTestStep = runningTestCase.getStep(2);
+		m_runningTestStep = runningTestCase.getStep(1);
+
+		m_service->handleTestStepEnd(model::Status::PASSED);
+		ASSERT_EQ(model::Stage::FINISHED, nestedTestStep->getStage());
+		ASSERT_EQ(model::Stage::RUNNING, m_runningTestStep->getStage());
+		ASSERT_EQ(0, nestedTestStep->getNestedStepsCount());
+
+		m_service->handleTestStepEnd(model::Status::PASSED);
+		ASSERT_EQ(model::Stage::FINISHED, m_runningTestStep->getStage());
+		ASSERT_EQ(1, m_runningTestStep->getNestedStepsCount());
+	}
+
 	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndThrowsExceptionWhenNoRunningTestStep)
 	{
 		m_runningTestStep->setStage(model::Stage::FINISHED);
@@ -56,7 +56,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			m_timeService = timeService.get();
 
 			m_currentTime = 987654321;
-			ON_CALL(*m_timeService, getCurrentTime()).WillByDefault(Return(m_currentTime));
+			ON_CALL(*m_timeService, getCurrentTimeMs()).WillByDefault(Return(m_currentTime));
 
 			return timeService;
 		}
@@ -67,7 +67,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		MockTimeService* m_timeService;
 
 		model::TestCase* m_runningTestCase;
-		time_t m_currentTime;
+		int64_t m_currentTime;
 	};
 
 
@@ -3,9 +3,12 @@
 
 #include "Model/TestProgram.h"
 
+#include "TestUtilities/Mocks/Services/Report/MockTestProgramJSONBuilder.h"
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 #include "TestUtilities/Mocks/Services/System/MockUUIDGeneratorService.h"
 
+#include <stdexcept>
+
 
 using namespace testing;
 using namespace systelab::gtest_allure;
@@ -20,8 +23,9 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		{
 			setUpTestProgram();
 			auto timeService = buildTimeService();
+			auto testProgramJSONBuilder = buildTestProgramJSONBuilder();
 
-			m_service = std::make_unique<service::TestSuiteEndEventHandler>(m_testProgram, std::move(timeService));
+			m_service = std::make_unique<service::TestSuiteEndEventHandler>(m_testProgram, std::move(timeService), std::move(testProgramJSONBuilder));
 		}
 
 		void setUpTestProgram()
@@ -32,6 +36,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 
 			model::TestSuite runningTestSuite;
 			runningTestSuite.setStage(model::Stage::RUNNING);
+			runningTestSuite.addTestCase(model::TestCase());
 			m_testProgram.addTestSuite(runningTestSuite);
 
 			m_runningTestSuite = &m_testProgram.getTestSuite(1);
@@ -43,18 +48,26 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			m_timeService = timeService.get();
 
 			m_currentTime = 123456789;
-			ON_CALL(*m_timeService, getCurrentTime()).WillByDefault(Return(m_currentTime));
+			ON_CALL(*m_timeService, getCurrentTimeMs()).WillByDefault(Return(m_currentTime));
 
 			return timeService;
 		}
 
+		std::unique_ptr<service::ITestProgramJSONBuilder> buildTestProgramJSONBuilder()
+		{
+			auto testProgramJSONBuilder = std::make_unique<MockTestProgramJSONBuilder>();
+			m_testProgramJSONBuilder = testProgramJSONBuilder.get();
+			return testProgramJSONBuilder;
+		}
+
 	protected:
 		std::unique_ptr<service::TestSuiteEndEventHandler> m_service;
 		model::TestProgram m_testProgram;
 		MockTimeService* m_timeService;
+		MockTestProgramJSONBuilder* m_testProgramJSONBuilder;
 
 		model::TestSuite* m_runningTestSuite;
-		time_t m_currentTime;
+		int64_t m_currentTime;
 	};
 
 
@@ -97,6 +110,71 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_EQ("https://www.mycompany.com/9876/page", testSuiteLinks[0].getURL());
 	}
 
+	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndAddsTMSLinkWithNamedAndRepeatedPlaceholders)
+	{
+		m_testProgram.setTMSLinksPattern("https://tms/{suite}/{id}?ref={}&{unknown}");
+		m_runningTestSuite->setName("MySuite");
+		m_runningTestSuite->setTmsId("TC-7");
+
+		m_service->handleTestSuiteEnd(model::Status::PASSED);
+
+		auto testSuiteLinks = m_runningTestSuite->getLinks();
+		ASSERT_EQ(1, testSuiteLinks.size());
+		ASSERT_EQ("https://tms/MySuite/TC-7?ref=TC-7&{unknown}", testSuiteLinks[0].getURL());
+	}
+
+	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndAddsTMSLinkWithPatternAsURLWhenNoPlaceholders)
+	{
+		m_testProgram.setTMSLinksPattern("https://tms/home");
+		m_runningTestSuite->setTmsId("TC-8");
+
+		m_service->handleTestSuiteEnd(model::Status::PASSED);
+
+		auto testSuiteLinks = m_runningTestSuite->getLinks();
+		ASSERT_EQ(1, testSuiteLinks.size());
+		ASSERT_EQ("https://tms/home", testSuiteLinks[0].getURL());
+	}
+
+	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndDoesNotReportTestSuiteByDefault)
+	{
+		EXPECT_CALL(*m_testProgramJSONBuilder, buildJSONFile(_, _)).Times(0);
+
+		m_service->handleTestSuiteEnd(model::Status::PASSED);
+
+		ASSERT_FALSE(m_runningTestSuite->isReported());
+		ASSERT_EQ(1, m_runningTestSuite->getTestCases().size());
+	}
+
+	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndReportsAndReleasesTestSuiteWhenIncrementalReportsEnabled)
+	{
+		m_testProgram.setIncrementalReports(true);
+		EXPECT_CALL(*m_testProgramJSONBuilder, buildJSONFile(Ref(m_testProgram), Ref(*m_runningTestSuite)))
+			.WillOnce(Invoke([](const model::TestProgram&, const model::TestSuite& testSuite)
+			{
+				ASSERT_EQ(model::Stage::FINISHED, testSuite.getStage());
+				ASSERT_EQ(1, testSuite.getLinks().size());
+				ASSERT_EQ(1, testSuite.getTestCases().size());
+			}));
+
+		m_service->handleTestSuiteEnd(model::Status::PASSED);
+
+		ASSERT_TRUE(m_runningTestSuite->isReported());
+		ASSERT_EQ(0, m_runningTestSuite->getTestCases().size());
+	}
+
+	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndKeepsTestSuiteUnreportedWhenReportFails)
+	{
+		m_testProgram.setIncrementalReports(true);
+		EXPECT_CALL(*m_testProgramJSONBuilder, buildJSONFile(Ref(m_testProgram), Ref(*m_runningTestSuite)))
+			.WillOnce(Throw(std::runtime_error("Unable to save report file")));
+
+		ASSERT_NO_THROW(m_service->handleTestSuiteEnd(model::Status::PASSED));
+
+		ASSERT_EQ(model::Stage::FINISHED, m_runningTestSuite->getStage());
+		ASSERT_FALSE(m_runningTestSuite->isReported());
+		ASSERT_EQ(1, m_runningTestSuite->getTestCases().size());
+	}
+
 	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndThrowsExceptionWhenNoRunningTestSuite)
 	{
 		m_runningTestSuite->setStage(model::Stage::FINISHED);
@@ -0,0 +1,166 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/Report/Allure2TestResultJSONSerializer.h"
+
+#include "GTestAllureUtilities/Services/Report/Allure2TestResult.h"
+
+#include "Model/TestProperty.h"
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class Allure2TestResultJSONSerializerTest : public Test
+	{
+	public:
+		service::Allure2TestResult buildMinimalResult()
+		{
+			service::Allure2TestResult result;
+			result.uuid = "0b4a6c42-5b43-4d8e-9f2c-2f6b4b1f9a10";
+			result.historyId = "a1b2c3";
+			result.name = "testName";
+			result.fullName = "Suite.testName";
+			result.status = "passed";
+			result.suiteName = "Suite";
+			result.environmentLabels = std::make_shared<const std::vector<AllureAPI::Label>>(
+				service::Allure2TestResultJSONSerializer::buildEnvironmentLabels("myhost", "123@myhost.1"));
+			result.start = 1000;
+			result.stop = 1005;
+
+			return result;
+		}
+
+	protected:
+		service::Allure2TestResultJSONSerializer m_service;
+	};
+
+
+	TEST_F(Allure2TestResultJSONSerializerTest, testSerializeMinimalResult)
+	{
+		auto result = buildMinimalResult();
+
+		std::string expectedSerializedResult =
+			"{\"uuid\":\"0b4a6c42-5b43-4d8e-9f2c-2f6b4b1f9a10\",\"historyId\":\"a1b2c3\","
+			"\"name\":\"testName\",\"testCaseName\":\"testName\",\"fullName\":\"Suite.testName\","
+			"\"status\":\"passed\",\"stage\":\"finished\",\"description\":\"\","
+			"\"labels\":[{\"name\":\"suite\",\"value\":\"Suite\"},"
+			"{\"name\":\"host\",\"value\":\"myhost\"},"
+			"{\"name\":\"thread\",\"value\":\"123@myhost.1\"},"
+			"{\"name\":\"framework\",\"value\":\"gtest\"},"
+			"{\"name\":\"language\",\"value\":\"cpp\"}],"
+			"\"links\":[],\"steps\":[],\"attachments\":[],\"parameters\":[],"
+			"\"start\":1000,\"stop\":1005}";
+
+		ASSERT_EQ(expectedSerializedResult, m_service.serialize(result));
+	}
+
+	TEST_F(Allure2TestResultJSONSerializerTest, testSerializeResultWithLabelsLinksStepsAttachmentsAndParameters)
+	{
+		auto result = buildMinimalResult();
+		result.status = "failed";
+		auto configuration = std::make_shared<AllureAPI::Configuration>();
+		configuration->description = "Feature \"X\"";
+		configuration->suiteLabels[model::test_property::NAME_PROPERTY] = "Suite";
+		configuration->suiteLabels["epic"] = "Epic";
+		configuration->tmsId = "TC-1";
+		configuration->tmsLinkTemplate = model::LinkTemplate("http://tms/{suite}/{id}");
+		result.configuration = configuration;
+		result.data.tags = { "smoke" };
+		result.data.labels = { { "owner", "me" }, { "", "ignored" } };
+
+		AllureAPI::Step step;
+		step.name = "Action: do";
+		step.status = "passed";
+		step.startMs = 1001;
+		step.stopMs = 1002;
+		step.parameters.push_back({ "p", "1" });
+		step.attachments.push_back({ "log", "log.txt", "text/plain" });
+		result.data.steps.push_back(step);
+
+		result.data.attachments.push_back({ "screenshot", "s.png", "image/png" });
+		result.data.parameters.push_back({ "param", "value" });
+
+		std::string expectedSerializedResult =
+			"{\"uuid\":\"0b4a6c42-5b43-4d8e-9f2c-2f6b4b1f9a10\",\"historyId\":\"a1b2c3\","
+			"\"name\":\"testName\",\"testCaseName\":\"testName\",\"fullName\":\"Suite.testName\","
+			"\"status\":\"failed\",\"stage\":\"finished\",\"description\":\"Feature \\\"X\\\"\","
+			"\"labels\":[{\"name\":\"suite\",\"value\":\"Suite\"},"
+			"{\"name\":\"epic\",\"value\":\"Epic\"},"
+			"{\"name\":\"tag\",\"value\":\"smoke\"},"
+			"{\"name\":\"owner\",\"value\":\"me\"},"
+			"{\"name\":\"host\",\"value\":\"myhost\"},"
+			"{\"name\":\"thread\",\"value\":\"123@myhost.1\"},"
+			"{\"name\":\"framework\",\"value\":\"gtest\"},"
+			"{\"name\":\"language\",\"value\":\"cpp\"}],"
+			"\"links\":[{\"type\":\"tms\",\"name\":\"TC-1\",\"url\":\"http://tms/Suite/TC-1\"}],"
+			"\"steps\":[{\"name\":\"Action: do\",\"status\":\"passed\",\"stage\":\"finished\",\"steps\":[],"
+			"\"start\":1001,\"stop\":1002,"
+			"\"parameters\":[{\"name\":\"p\",\"value\":\"1\"}],"
+			"\"attachments\":[{\"name\":\"log\",\"source\":\"log.txt\",\"type\":\"text/plain\"}]}],"
+			"\"attachments\":[{\"name\":\"screenshot\",\"source\":\"s.png\",\"type\":\"image/png\"}],"
+			"\"parameters\":[{\"name\":\"param\",\"value\":\"value\"}],"
+			"\"start\":1000,\"stop\":1005}";
+
+		ASSERT_EQ(expectedSerializedResult, m_service.serialize(result));
+	}
+
+	TEST_F(Allure2TestResultJSONSerializerTest, testSerializeResultWithNestedSteps)
+	{
+		auto result = buildMinimalResult();
+
+		// outer { inner { innermost } }, sibling
+		std::vector< std::pair<std::string, unsigned int> > steps =
+			{ { "outer", 2 }, { "inner", 1 }, { "innermost", 0 }, { "sibling", 0 } };
+		for (const auto& [name, nestedStepsCount] : steps)
+		{
+			AllureAPI::Step step;
+			step.name = name;
+			step.status = "passed";
+			step.startMs = 1001;
+			step.stopMs = 1002;
+			step.nestedStepsCount = nestedStepsCount;
+			result.data.steps.push_back(step);
+		}
+
+		auto buildStepJSON = [](const std::string& name, const std::string& nestedStepsJSON)
+		{
+			return "{\"name\":\"" + name + "\",\"status\":\"passed\",\"stage\":\"finished\","
+				   "\"steps\":[" + nestedStepsJSON + "],\"start\":1001,\"stop\":1002,"
+				   "\"parameters\":[],\"attachments\":[]}";
+		};
+
+		std::string expectedStepsJSON =
+			"\"steps\":[" +
+			buildStepJSON("outer", buildStepJSON("inner", buildStepJSON("innermost", ""))) + "," +
+			buildStepJSON("sibling", "") + "]";
+
+		ASSERT_THAT(m_service.serialize(result), HasSubstr(expectedStepsJSON));
+	}
+
+	TEST_F(Allure2TestResultJSONSerializerTest, testSerializeEscapesEnvironmentLabelValues)
+	{
+		auto result = buildMinimalResult();
+		result.environmentLabels = std::make_shared<const std::vector<AllureAPI::Label>>(
+			service::Allure2TestResultJSONSerializer::buildEnvironmentLabels("my\"host", "1@my\"host.2"));
+
+		std::string expectedEnvironmentLabels =
+			"{\"name\":\"host\",\"value\":\"my\\\"host\"},"
+			"{\"name\":\"thread\",\"value\":\"1@my\\\"host.2\"},"
+			"{\"name\":\"framework\",\"value\":\"gtest\"},"
+			"{\"name\":\"language\",\"value\":\"cpp\"}]";
+
+		ASSERT_THAT(m_service.serialize(result), HasSubstr(expectedEnvironmentLabels));
+	}
+
+	TEST_F(Allure2TestResultJSONSerializerTest, testSerializeIntoBufferReplacesPreviousContent)
+	{
+		auto result = buildMinimalResult();
+
+		std::string buffer = "previous content";
+		m_service.serialize(result, buffer);
+
+		ASSERT_EQ(m_service.serialize(result), buffer);
+	}
+
+}}}
@@ -0,0 +1,305 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/Report/Allure2TestResultWriter.h"
+
+#include "TestUtilities/Mocks/Services/Report/MockAllure2TestResultJSONSerializer.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+using namespace systelab::gtest_allure::test_utility;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class Allure2TestResultWriterTest : public Test
+	{
+	public:
+		void SetUp()
+		{
+			auto serializer = std::make_unique<MockAllure2TestResultJSONSerializer>();
+			ON_CALL(*serializer, serialize(_)).WillByDefault(Invoke(
+				[this](const service::Allure2TestResult& result) -> std::string
+				{
+					return serialize(result);
+				}
+			));
+
+			m_service = std::make_unique<service::Allure2TestResultWriter>(std::move(serializer));
+			m_service->setOutputFolder(m_outputFolder);
+		}
+
+		void TearDown()
+		{
+			releaseBlockedSerialization();
+			m_service.reset();
+			std::filesystem::remove_all(m_outputFolder);
+		}
+
+		service::Allure2TestResult buildResult(const std::string& uuid)
+		{
+			service::Allure2TestResult result;
+			result.uuid = uuid;
+			result.name = "testName";
+			result.fullName = "Suite.testName";
+			result.status = "passed";
+			result.start = 1000;
+			result.stop = 1005;
+
+			return result;
+		}
+
+		// Serializing the result given as blocking waits until released,
+		// and serializing the results given as failing throws
+		void blockSerializationOf(const std::string& uuid)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_blockingUUID = uuid;
+		}
+
+		void failSerializationOf(const std::string& uuid)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_failingUUIDs.insert(uuid);
+		}
+
+		void waitUntilBlockedSerializationStarts()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_stateChanged.wait(lock, [this]() { return m_blockedSerializationStarted; });
+		}
+
+		void releaseBlockedSerialization()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_blockingUUID.clear();
+			}
+
+			m_stateChanged.notify_all();
+		}
+
+		std::vector<std::string> getSerializedUUIDs() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_serializedUUIDs;
+		}
+
+		std::thread::id getSerializationThreadId(const std::string& uuid) const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_serializationThreadIds.find(uuid);
+			return (it != m_serializationThreadIds.end()) ? it->second : std::thread::id();
+		}
+
+		bool existsResultFile(const std::string& folderPath, const std::string& uuid) const
+		{
+			return std::filesystem::exists(std::filesystem::path(folderPath) / (uuid + "-result.json"));
+		}
+
+	private:
+		std::string serialize(const service::Allure2TestResult& result)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			if (result.uuid == m_blockingUUID)
+			{
+				m_blockedSerializationStarted = true;
+				m_stateChanged.notify_all();
+				m_stateChanged.wait(lock, [this, &result]() { return result.uuid != m_blockingUUID; });
+			}
+
+			m_serializedUUIDs.push_back(result.uuid);
+			m_serializationThreadIds[result.uuid] = std::this_thread::get_id();
+
+			if (m_failingUUIDs.count(result.uuid) > 0)
+			{
+				throw std::runtime_error("Unable to save " + result.uuid);
+			}
+
+			return "Serialized" + result.uuid;
+		}
+
+	protected:
+		std::unique_ptr<service::Allure2TestResultWriter> m_service;
+		std::string m_outputFolder = "Allure2TestResultWriterTest";
+
+	private:
+		mutable std::mutex m_mutex;
+		std::condition_variable m_stateChanged;
+		std::vector<std::string> m_serializedUUIDs;
+		std::map<std::string, std::thread::id> m_serializationThreadIds;
+		bool m_blockedSerializationStarted = false;
+		std::string m_blockingUUID;
+		std::set<std::string> m_failingUUIDs;
+	};
+
+
+	TEST_F(Allure2TestResultWriterTest, testWriteSavesResultOnCallingThreadWhenNotStarted)
+	{
+		m_service->write(buildResult("result-1"));
+
+		ASSERT_FALSE(m_service->isAsync());
+		ASSERT_EQ(std::vector<std::string>({ "result-1" }), getSerializedUUIDs());
+		ASSERT_EQ(std::this_thread::get_id(), getSerializationThreadId("result-1"));
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testWriteThrowsSaveErrorWhenNotStarted)
+	{
+		failSerializationOf("result-1");
+
+		ASSERT_THROW(m_service->write(buildResult("result-1")), std::runtime_error);
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testStartWithZeroQueueCapacityKeepsSavingSynchronously)
+	{
+		m_service->start(0, model::BackPressurePolicy::BLOCK);
+
+		ASSERT_FALSE(m_service->isAsync());
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testFlushSavesAllQueuedResultsInWriteOrderOnWriterThread)
+	{
+		m_service->start(16, model::BackPressurePolicy::BLOCK);
+		ASSERT_TRUE(m_service->isAsync());
+
+		for (unsigned int i = 0; i < 10; i++)
+		{
+			m_service->write(buildResult("result-" + std::to_string(i)));
+		}
+		m_service->flush();
+
+		auto savedUUIDs = getSerializedUUIDs();
+		ASSERT_EQ(10, savedUUIDs.size());
+		for (unsigned int i = 0; i < 10; i++)
+		{
+			ASSERT_EQ("result-" + std::to_string(i), savedUUIDs[i]);
+			ASSERT_NE(std::this_thread::get_id(), getSerializationThreadId(savedUUIDs[i]));
+		}
+		ASSERT_FALSE(m_service->isAsync());
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testWriteWaitsForRoomOnQueueWhenFullAndBlockPolicy)
+	{
+		m_service->start(1, model::BackPressurePolicy::BLOCK);
+		blockSerializationOf("result-1");
+
+		m_service->write(buildResult("result-1"));
+		waitUntilBlockedSerializationStarts();
+		m_service->write(buildResult("result-2"));
+
+		std::atomic<bool> thirdWriteDone { false };
+		std::thread writerClient([this, &thirdWriteDone]()
+		{
+			m_service->write(buildResult("result-3"));
+			thirdWriteDone = true;
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		EXPECT_FALSE(thirdWriteDone);
+
+		releaseBlockedSerialization();
+		writerClient.join();
+		m_service->flush();
+
+		ASSERT_EQ(std::vector<std::string>({ "result-1", "result-2", "result-3" }), getSerializedUUIDs());
+		ASSERT_NE(std::this_thread::get_id(), getSerializationThreadId("result-3"));
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testWriteSavesResultOnCallingThreadWhenQueueFullAndSpillPolicy)
+	{
+		m_service->start(1, model::BackPressurePolicy::SPILL_SYNCHRONOUSLY);
+		blockSerializationOf("result-1");
+
+		m_service->write(buildResult("result-1"));
+		waitUntilBlockedSerializationStarts();
+		m_service->write(buildResult("result-2"));
+		m_service->write(buildResult("result-3"));
+
+		ASSERT_EQ(std::vector<std::string>({ "result-3" }), getSerializedUUIDs());
+		ASSERT_EQ(std::this_thread::get_id(), getSerializationThreadId("result-3"));
+
+		releaseBlockedSerialization();
+		m_service->flush();
+
+		ASSERT_EQ(std::vector<std::string>({ "result-3", "result-1", "result-2" }), getSerializedUUIDs());
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testFlushRethrowsFirstSaveErrorAfterSavingRemainingResults)
+	{
+		failSerializationOf("result-1");
+		failSerializationOf("result-2");
+		m_service->start(16, model::BackPressurePolicy::BLOCK);
+
+		m_service->write(buildResult("result-1"));
+		m_service->write(buildResult("result-2"));
+		m_service->write(buildResult("result-3"));
+
+		try
+		{
+			m_service->flush();
+			FAIL() << "Expected save error to be rethrown";
+		}
+		catch (std::runtime_error& error)
+		{
+			ASSERT_STREQ("Unable to save result-1", error.what());
+		}
+
+		ASSERT_EQ(std::vector<std::string>({ "result-1", "result-2", "result-3" }), getSerializedUUIDs());
+		ASSERT_NO_THROW(m_service->flush());
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testWriteAfterFlushSavesResultOnCallingThread)
+	{
+		m_service->start(16, model::BackPressurePolicy::BLOCK);
+		m_service->write(buildResult("result-1"));
+		m_service->flush();
+
+		m_service->write(buildResult("result-2"));
+
+		ASSERT_FALSE(m_service->isAsync());
+		ASSERT_EQ(std::vector<std::string>({ "result-1", "result-2" }), getSerializedUUIDs());
+		ASSERT_EQ(std::this_thread::get_id(), getSerializationThreadId("result-2"));
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testQueuedResultsAreSavedIntoOutputFolderInForceWhenWritten)
+	{
+		m_service->setOutputFolder(m_outputFolder + "/First");
+		m_service->start(16, model::BackPressurePolicy::BLOCK);
+		blockSerializationOf("result-1");
+
+		m_service->write(buildResult("result-1"));
+		waitUntilBlockedSerializationStarts();
+		m_service->write(buildResult("result-2"));
+		m_service->setOutputFolder(m_outputFolder + "/Second");
+		m_service->write(buildResult("result-3"));
+
+		releaseBlockedSerialization();
+		m_service->flush();
+
+		ASSERT_TRUE(existsResultFile(m_outputFolder + "/First", "result-1"));
+		ASSERT_TRUE(existsResultFile(m_outputFolder + "/First", "result-2"));
+		ASSERT_FALSE(existsResultFile(m_outputFolder + "/First", "result-3"));
+		ASSERT_TRUE(existsResultFile(m_outputFolder + "/Second", "result-3"));
+	}
+
+	TEST_F(Allure2TestResultWriterTest, testWriteSavesSerializedResultIntoResultFile)
+	{
+		m_service->write(buildResult("result-1"));
+
+		std::ifstream resultFile(std::filesystem::path(m_outputFolder) / "result-1-result.json");
+		std::string content((std::istreambuf_iterator<char>(resultFile)), std::istreambuf_iterator<char>());
+		ASSERT_EQ("Serializedresult-1", content);
+	}
+
+}}}
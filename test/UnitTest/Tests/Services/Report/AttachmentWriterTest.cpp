@@ -0,0 +1,213 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/Report/AttachmentWriter.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class AttachmentWriterTest : public Test
+	{
+	public:
+		void SetUp()
+		{
+			m_outputFolder = "AttachmentWriterTest";
+			std::filesystem::remove_all(m_outputFolder);
+
+			m_service = std::make_unique<service::AttachmentWriter>();
+			m_service->setOutputFolder(m_outputFolder);
+		}
+
+		void TearDown()
+		{
+			m_service.reset();
+			std::filesystem::remove_all(m_outputFolder);
+		}
+
+		std::string readFile(const std::string& fileName)
+		{
+			std::ifstream fileStream(std::filesystem::path(m_outputFolder) / fileName, std::ios::binary);
+			std::stringstream buffer;
+			buffer << fileStream.rdbuf();
+			return buffer.str();
+		}
+
+	protected:
+		std::unique_ptr<service::AttachmentWriter> m_service;
+		std::string m_outputFolder;
+	};
+
+
+	TEST_F(AttachmentWriterTest, testSaveWritesGivenContentIntoOutputFolderOnceFlushed)
+	{
+		m_service->save("log-attachment.txt", "First line\nSecond line\n");
+		m_service->flush();
+
+		ASSERT_EQ("First line\nSecond line\n", readFile("log-attachment.txt"));
+		ASSERT_EQ(0, m_service->getPendingBytes());
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveKeepsBinaryContentUnchanged)
+	{
+		std::string content("\x89PNG\r\n\x1a\n\0\0\0\rIHDR", 16);
+		m_service->save("image-attachment.png", std::string(content));
+		m_service->flush();
+
+		ASSERT_EQ(content, readFile("image-attachment.png"));
+	}
+
+	TEST_F(AttachmentWriterTest, testAppendAddsContentAfterPreviouslySavedContent)
+	{
+		m_service->save("stream-attachment.txt", "chunk 1;");
+		m_service->append("stream-attachment.txt", "chunk 2;");
+		m_service->append("stream-attachment.txt", "chunk 3;");
+		m_service->flush();
+
+		ASSERT_EQ("chunk 1;chunk 2;chunk 3;", readFile("stream-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveReplacesContentOfExistingFile)
+	{
+		m_service->save("replaced-attachment.txt", "Previous content");
+		m_service->save("replaced-attachment.txt", "New content");
+		m_service->flush();
+
+		ASSERT_EQ("New content", readFile("replaced-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveOnceSavesFileOnlyTheFirstTime)
+	{
+		ASSERT_TRUE(m_service->saveOnce("golden-attachment.txt", "Golden content"));
+		ASSERT_FALSE(m_service->saveOnce("golden-attachment.txt", "Golden content"));
+		m_service->flush();
+
+		ASSERT_EQ("Golden content", readFile("golden-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveOnceDoesNotWriteAlreadySavedFileAgain)
+	{
+		m_service->saveOnce("golden-attachment.txt", "Golden content");
+		m_service->flush();
+		std::filesystem::remove(std::filesystem::path(m_outputFolder) / "golden-attachment.txt");
+
+		m_service->saveOnce("golden-attachment.txt", "Golden content");
+		m_service->flush();
+
+		ASSERT_FALSE(std::filesystem::exists(std::filesystem::path(m_outputFolder) / "golden-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveOnceSavesFileAgainIntoNewOutputFolder)
+	{
+		m_service->saveOnce("golden-attachment.txt", "Golden content");
+		m_service->flush();
+
+		std::string previousOutputFolder = m_outputFolder;
+		m_outputFolder += "/NewFolder";
+		m_service->setOutputFolder(m_outputFolder);
+
+		ASSERT_TRUE(m_service->saveOnce("golden-attachment.txt", "Golden content"));
+		m_service->flush();
+
+		ASSERT_EQ("Golden content", readFile("golden-attachment.txt"));
+		m_outputFolder = previousOutputFolder;
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveOnceSavesFileAgainAfterFailedSave)
+	{
+		std::filesystem::create_directories(m_outputFolder);
+		std::string notAFolder = m_outputFolder + "/NotAFolder";
+		std::ofstream(notAFolder) << "Regular file";
+		m_service->setOutputFolder(notAFolder);
+
+		ASSERT_TRUE(m_service->saveOnce("golden-attachment.txt", "Golden content"));
+		ASSERT_THROW(m_service->flush(), service::OutputFolder::UnableToOpenFolderException);
+
+		std::filesystem::remove(notAFolder);
+		ASSERT_TRUE(m_service->saveOnce("golden-attachment.txt", "Golden content"));
+		m_service->flush();
+
+		ASSERT_EQ("Golden content", readFile("NotAFolder/golden-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testQueuedFilesAreSavedIntoOutputFolderSetWhenWritten)
+	{
+		m_service->save("first-attachment.txt", "First");
+		m_service->setOutputFolder(m_outputFolder + "/NewFolder");
+		m_service->save("second-attachment.txt", "Second");
+		m_service->flush();
+
+		ASSERT_EQ("First", readFile("first-attachment.txt"));
+		ASSERT_EQ("Second", readFile("NewFolder/second-attachment.txt"));
+		ASSERT_FALSE(std::filesystem::exists(std::filesystem::path(m_outputFolder) / "NewFolder" / "first-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testPendingBytesNeverExceedCapacity)
+	{
+		const size_t capacity = 1000;
+		m_service->setPendingBytesCapacity(capacity);
+
+		for (unsigned int i = 0; i < 200; i++)
+		{
+			m_service->save("attachment-" + std::to_string(i) + ".txt", std::string(100, 'x'));
+			ASSERT_LE(m_service->getPendingBytes(), capacity);
+		}
+
+		m_service->flush();
+		ASSERT_EQ(0, m_service->getPendingBytes());
+		ASSERT_EQ(std::string(100, 'x'), readFile("attachment-199.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveAcceptsContentLargerThanCapacity)
+	{
+		m_service->setPendingBytesCapacity(16);
+
+		m_service->save("large-attachment-1.txt", std::string(1024, 'a'));
+		m_service->save("large-attachment-2.txt", std::string(1024, 'b'));
+		m_service->flush();
+
+		ASSERT_EQ(std::string(1024, 'a'), readFile("large-attachment-1.txt"));
+		ASSERT_EQ(std::string(1024, 'b'), readFile("large-attachment-2.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveAfterFlushStartsWriterAgain)
+	{
+		m_service->save("first-attachment.txt", "First");
+		m_service->flush();
+		m_service->save("second-attachment.txt", "Second");
+		m_service->flush();
+
+		ASSERT_EQ("First", readFile("first-attachment.txt"));
+		ASSERT_EQ("Second", readFile("second-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testSaveAfterFlushRecreatesRemovedOutputFolder)
+	{
+		m_service->save("first-attachment.txt", "First content");
+		m_service->flush();
+		std::filesystem::remove_all(m_outputFolder);
+
+		m_service->save("second-attachment.txt", "Second content");
+		m_service->flush();
+
+		ASSERT_EQ("Second content", readFile("second-attachment.txt"));
+	}
+
+	TEST_F(AttachmentWriterTest, testFlushThrowsExceptionWhenUnableToOpenOutputFolder)
+	{
+		std::filesystem::create_directories(m_outputFolder);
+		std::string notAFolder = m_outputFolder + "/NotAFolder.txt";
+		std::ofstream(notAFolder) << "Regular file";
+		m_service->setOutputFolder(notAFolder + "/Subfolder");
+
+		m_service->save("lost-attachment.txt", "Content");
+
+		ASSERT_THROW(m_service->flush(), service::OutputFolder::UnableToOpenFolderException);
+		ASSERT_NO_THROW(m_service->flush());
+	}
+
+}}}
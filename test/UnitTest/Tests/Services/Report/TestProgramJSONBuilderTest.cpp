@@ -7,6 +7,8 @@
 #include "TestUtilities/Mocks/Services/System/MockFileService.h"
 #include "TestUtilities/Mocks/Services/Report/MockTestSuiteJSONSerializer.h"
 
+#include <mutex>
+
 
 using namespace testing;
 using namespace systelab::gtest_allure;
@@ -91,6 +93,24 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		m_service->buildJSONFiles(*m_testProgram);
 	}
 
+	TEST_F(TestProgramJSONBuilderTest, testBuildJSONFilesSkipsTestSuitesAlreadyReported)
+	{
+		m_testProgram->getTestSuite(1).setReported(true);
+
+		EXPECT_CALL(*m_fileService, saveFile(m_outputFolder + "\\UUID1-" + m_testProgramName + ".json", _));
+		EXPECT_CALL(*m_fileService, saveFile(m_outputFolder + "\\UUID2-" + m_testProgramName + ".json", _)).Times(0);
+		EXPECT_CALL(*m_fileService, saveFile(m_outputFolder + "\\UUID3-" + m_testProgramName + ".json", _));
+
+		m_service->buildJSONFiles(*m_testProgram);
+	}
+
+	TEST_F(TestProgramJSONBuilderTest, testBuildJSONFileSavesFileOfGivenTestSuite)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(m_outputFolder + "\\UUID2-" + m_testProgramName + ".json", "SerializedUUID2"));
+
+		m_service->buildJSONFile(*m_testProgram, m_testProgram->getTestSuite(1));
+	}
+
 	TEST_F(TestProgramJSONBuilderTest, testBuildJSONFilesDoesNotSaveAFileWhenSuiteHasNoTestCases)
 	{
 		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(0);
@@ -99,4 +119,124 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		m_service->buildJSONFiles(emptyTestProgram);
 	}
 
+
+	class TestProgramJSONBuilderParallelTest : public testing::Test
+	{
+		void SetUp()
+		{
+			m_testProgram = buildTestProgram();
+
+			auto fileService = std::make_unique<MockFileService>();
+			m_fileService = fileService.get();
+
+			m_service = std::make_unique<service::TestProgramJSONBuilder>([this](const model::TestProgram&) { return buildTestSuiteJSONSerializer(); }, std::move(fileService));
+		}
+
+		std::unique_ptr<model::TestProgram> buildTestProgram()
+		{
+			auto testProgram = std::make_unique<model::TestProgram>();
+			testProgram->setName("MyParallelTestProgram");
+			testProgram->setOutputFolder("Reports");
+			testProgram->setReportWorkersCount(3);
+
+			for (unsigned int i = 0; i < 20; i++)
+			{
+				model::TestSuite testSuite;
+				testSuite.setUUID("UUID" + std::to_string(i));
+				testProgram->addTestSuite(testSuite);
+			}
+
+			return testProgram;
+		}
+
+		std::unique_ptr<service::ITestSuiteJSONSerializer> buildTestSuiteJSONSerializer()
+		{
+			auto testSuiteJSONSerializer = std::make_unique<MockTestSuiteJSONSerializer>();
+			std::lock_guard<std::mutex> lock(m_testSuiteJSONSerializersMutex);
+			m_testSuiteJSONSerializersCount++;
+
+			ON_CALL(*testSuiteJSONSerializer, serialize(_)).WillByDefault(Invoke(
+				[](const model::TestSuite& testSuite) -> std::string
+				{
+					return std::string("Serialized") + testSuite.getUUID();
+				}
+			));
+
+			return testSuiteJSONSerializer;
+		}
+
+	protected:
+		std::unique_ptr<service::TestProgramJSONBuilder> m_service;
+		std::mutex m_testSuiteJSONSerializersMutex;
+		unsigned int m_testSuiteJSONSerializersCount = 0;
+		MockFileService* m_fileService;
+
+		std::unique_ptr<model::TestProgram> m_testProgram;
+	};
+
+
+	TEST_F(TestProgramJSONBuilderParallelTest, testBuildJSONFilesSavesEachTestSuiteOnceWithSameContentAsSequentialBuild)
+	{
+		for (unsigned int i = 0; i < 20; i++)
+		{
+			std::string testSuiteUUID = "UUID" + std::to_string(i);
+			std::string expectedFilepath = "Reports\\" + testSuiteUUID + "-MyParallelTestProgram.json";
+			EXPECT_CALL(*m_fileService, saveFile(expectedFilepath, "Serialized" + testSuiteUUID)).Times(1);
+		}
+
+		m_service->buildJSONFiles(*m_testProgram);
+	}
+
+	TEST_F(TestProgramJSONBuilderParallelTest, testBuildJSONFilesBuildsASerializerForEachWorkerCountSetBeforeBuildingFiles)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(AnyNumber());
+		m_testProgram->setReportWorkersCount(5);
+
+		m_service->buildJSONFiles(*m_testProgram);
+
+		ASSERT_EQ(5, m_testSuiteJSONSerializersCount);
+	}
+
+	TEST_F(TestProgramJSONBuilderParallelTest, testBuildJSONFilesBuildsNoMoreSerializersThanTestSuites)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(AnyNumber());
+		m_testProgram->setReportWorkersCount(50);
+
+		m_service->buildJSONFiles(*m_testProgram);
+
+		ASSERT_EQ(20, m_testSuiteJSONSerializersCount);
+	}
+
+	TEST_F(TestProgramJSONBuilderParallelTest, testBuildJSONFilesBuildsNoSerializerWhenNoTestSuites)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(0);
+
+		model::TestProgram emptyTestProgram;
+		emptyTestProgram.setReportWorkersCount(0);
+		m_service->buildJSONFiles(emptyTestProgram);
+
+		ASSERT_EQ(0, m_testSuiteJSONSerializersCount);
+	}
+
+	TEST_F(TestProgramJSONBuilderParallelTest, testBuildJSONFilesBuildsSerializersAgainOnEachCall)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(AnyNumber());
+		m_testProgram->setReportWorkersCount(1);
+
+		m_service->buildJSONFiles(*m_testProgram);
+		m_service->buildJSONFile(*m_testProgram, m_testProgram->getTestSuite(0));
+		m_service->buildJSONFiles(*m_testProgram);
+
+		ASSERT_EQ(3, m_testSuiteJSONSerializersCount);
+	}
+
+	TEST_F(TestProgramJSONBuilderParallelTest, testBuildJSONFilesRethrowsExceptionRaisedByAWorker)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(AnyNumber());
+		EXPECT_CALL(*m_fileService, saveFile("Reports\\UUID7-MyParallelTestProgram.json", _))
+			.WillRepeatedly(Throw(service::IFileService::UnableToWriteFileException("UUID7", "Disk full")));
+
+		ASSERT_THROW(m_service->buildJSONFiles(*m_testProgram), service::IFileService::UnableToWriteFileException);
+	}
+
 }}}
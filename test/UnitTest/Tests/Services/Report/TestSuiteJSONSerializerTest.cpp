@@ -1,8 +1,7 @@
 #include "stdafx.h"
 #include "GTestAllureUtilities/Services/Report/TestSuiteJSONSerializer.h"
 
-#include "Model/Action.h"
-#include "Model/ExpectedResult.h"
+#include "Model/Step.h"
 #include "Model/TestSuite.h"
 
 #include "RapidJSONAdapter/JSONAdapter.h"
@@ -146,20 +145,20 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		testCase.setStart(124000);
 		testCase.setStop(789000);
 
-		auto action = std::make_unique<model::Action>();
-		action->setName("Execute algorithm");
-		action->setStatus(model::Status::PASSED);
-		action->setStage(model::Stage::FINISHED);
-		action->setStart(125000);
-		action->setStop(126000);
+		model::Step action(model::StepType::ACTION_STEP);
+		action.setName("Execute algorithm");
+		action.setStatus(model::Status::PASSED);
+		action.setStage(model::Stage::FINISHED);
+		action.setStart(125000);
+		action.setStop(126000);
 		testCase.addStep(std::move(action));
 
-		auto expectedResult = std::make_unique<model::ExpectedResult>();
-		expectedResult->setName("Algorithm result is 10");
-		expectedResult->setStatus(model::Status::UNKNOWN);
-		expectedResult->setStage(model::Stage::RUNNING);
-		expectedResult->setStart(126000);
-		expectedResult->setStop(127000);
+		model::Step expectedResult(model::StepType::EXPECTED_RESULT_STEP);
+		expectedResult.setName("Algorithm result is 10");
+		expectedResult.setStatus(model::Status::UNKNOWN);
+		expectedResult.setStage(model::Stage::RUNNING);
+		expectedResult.setStart(126000);
+		expectedResult.setStop(127000);
 		testCase.addStep(std::move(expectedResult));
 
 		testSuite.addTestCase(testCase);
@@ -208,4 +207,103 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_TRUE(compareJSONs(expectedSerializedTestSuite, serializedTestSuite, m_jsonAdapter));
 	}
 
+
+	TEST_F(TestSuiteJSONSerializerTest, testSerializeForTCWithNestedSteps)
+	{
+		model::TestSuite testSuite;
+		testSuite.setUUID("5D0C6C4E-44B5-4C5E-8E55-2B6B0E7C1F00");
+		testSuite.setName("Test suite with nested steps");
+		testSuite.setStatus(model::Status::PASSED);
+		testSuite.setStage(model::Stage::FINISHED);
+		testSuite.setStart(100);
+		testSuite.setStop(900);
+
+		model::TestCase testCase;
+		testCase.setName("Test case with nested steps");
+		testCase.setStatus(model::Status::PASSED);
+		testCase.setStage(model::Stage::FINISHED);
+		testCase.setStart(200);
+		testCase.setStop(800);
+
+		model::Step outerAction(model::StepType::ACTION_STEP);
+		outerAction.setName("Prepare environment");
+		outerAction.setStatus(model::Status::PASSED);
+		outerAction.setStage(model::Stage::FINISHED);
+		outerAction.setStart(300);
+		outerAction.setStop(500);
+		outerAction.setNestedStepsCount(1);
+		testCase.addStep(outerAction);
+
+		model::Step innerAction(model::StepType::ACTION_STEP);
+		innerAction.setName("Create folder");
+		innerAction.setStatus(model::Status::PASSED);
+		innerAction.setStage(model::Stage::FINISHED);
+		innerAction.setStart(350);
+		innerAction.setStop(450);
+		testCase.addStep(innerAction);
+
+		model::Step expectedResult(model::StepType::EXPECTED_RESULT_STEP);
+		expectedResult.setName("Environment is ready");
+		expectedResult.setStatus(model::Status::PASSED);
+		expectedResult.setStage(model::Stage::FINISHED);
+		expectedResult.setStart(600);
+		expectedResult.setStop(700);
+		testCase.addStep(expectedResult);
+
+		testSuite.addTestCase(testCase);
+
+		std::string expectedSerializedTestSuite =
+			"{\n"
+			"    \"uuid\": \"5D0C6C4E-44B5-4C5E-8E55-2B6B0E7C1F00\",\n"
+			"    \"name\": \"Test suite with nested steps\",\n"
+			"    \"status\": \"passed\",\n"
+			"    \"stage\": \"finished\",\n"
+			"    \"start\": 100,\n"
+			"    \"stop\": 900,\n"
+			"    \"labels\": [\n"
+			"         { \"name\": \"suite\", \"value\": \"Test suite with nested steps\"}"
+			"    ],\n"
+			"    \"steps\":\n"
+			"    ["
+			"        {\n"
+			"            \"name\": \"Action: Test case with nested steps\",\n"
+			"            \"status\": \"passed\",\n"
+			"            \"stage\": \"finished\",\n"
+			"            \"start\": 200,\n"
+			"            \"stop\": 800,\n"
+			"            \"steps\":\n"
+			"            [\n"
+			"                {\n"
+			"                    \"name\": \"Action: Prepare environment\",\n"
+			"                    \"status\": \"passed\",\n"
+			"                    \"stage\": \"finished\",\n"
+			"                    \"start\": 300,\n"
+			"                    \"stop\": 500,\n"
+			"                    \"steps\":\n"
+			"                    [\n"
+			"                        {\n"
+			"                            \"name\": \"Action: Create folder\",\n"
+			"                            \"status\": \"passed\",\n"
+			"                            \"stage\": \"finished\",\n"
+			"                            \"start\": 350,\n"
+			"                            \"stop\": 450\n"
+			"                        }\n"
+			"                    ]\n"
+			"                },\n"
+			"                {\n"
+			"                    \"name\": \"Environment is ready\",\n"
+			"                    \"status\": \"passed\",\n"
+			"                    \"stage\": \"finished\",\n"
+			"                    \"start\": 600,\n"
+			"                    \"stop\": 700\n"
+			"                }\n"
+			"            ]\n"
+			"        }\n"
+			"    ]\n"
+			"}";
+
+		std::string serializedTestSuite = m_service->serialize(testSuite);
+		ASSERT_TRUE(compareJSONs(expectedSerializedTestSuite, serializedTestSuite, m_jsonAdapter));
+	}
+
 }}}
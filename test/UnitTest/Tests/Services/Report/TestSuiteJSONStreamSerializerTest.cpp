@@ -0,0 +1,174 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/Report/TestSuiteJSONStreamSerializer.h"
+#include "GTestAllureUtilities/Services/Report/TestSuiteJSONSerializer.h"
+
+#include "Model/Step.h"
+#include "Model/TestSuite.h"
+
+#include "RapidJSONAdapter/JSONAdapter.h"
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class TestSuiteJSONStreamSerializerTest : public Test
+	{
+	public:
+		void SetUp()
+		{
+			m_service = std::make_unique<service::TestSuiteJSONStreamSerializer>();
+
+			auto jsonAdapter = std::make_unique<systelab::json::rapidjson::JSONAdapter>();
+			m_documentSerializer = std::make_unique<service::TestSuiteJSONSerializer>(std::move(jsonAdapter));
+		}
+
+		model::TestSuite buildTestSuite(const std::string& name)
+		{
+			model::TestSuite testSuite;
+			testSuite.setUUID("3E43CDC5-0839-4ABB-8ED2-BE669F89D512");
+			testSuite.setName(name);
+			testSuite.setStatus(model::Status::FAILED);
+			testSuite.setStage(model::Stage::FINISHED);
+			testSuite.setStart(123456);
+			testSuite.setStop(789012);
+			return testSuite;
+		}
+
+		void addLinksAndLabels(model::TestSuite& testSuite)
+		{
+			model::Link link;
+			link.setName("TC link 1");
+			link.setURL("http://www.mylink1.com");
+			link.setType("tms");
+			testSuite.addLink(link);
+
+			model::Label label1;
+			label1.setName("package");
+			label1.setValue("UnitTest");
+			testSuite.addLabel(label1);
+
+			model::Label label2;
+			label2.setName("feature");
+			label2.setValue("TestSuiteJSONStreamSerializer");
+			testSuite.addLabel(label2);
+		}
+
+		void addTestCases(model::TestSuite& testSuite)
+		{
+			model::TestCase testCaseWithSteps;
+			testCaseWithSteps.setName("Test case with steps");
+			testCaseWithSteps.setStatus(model::Status::BROKEN);
+			testCaseWithSteps.setStage(model::Stage::INTERRUPTED);
+			testCaseWithSteps.setStart(124000);
+			testCaseWithSteps.setStop(789000);
+			testCaseWithSteps.addStep(buildStep(model::StepType::ACTION_STEP, "Execute algorithm", model::Status::PASSED));
+			testCaseWithSteps.addStep(buildStep(model::StepType::EXPECTED_RESULT_STEP, "Algorithm result is 10", model::Status::UNKNOWN));
+			testSuite.addTestCase(testCaseWithSteps);
+
+			model::TestCase testCaseWithoutSteps;
+			testCaseWithoutSteps.setName("Test case without steps");
+			testCaseWithoutSteps.setStatus(model::Status::PASSED);
+			testCaseWithoutSteps.setStage(model::Stage::FINISHED);
+			testCaseWithoutSteps.setStart(790000);
+			testCaseWithoutSteps.setStop(791000);
+			testSuite.addTestCase(testCaseWithoutSteps);
+		}
+
+		model::Step buildStep(model::StepType type, const std::string& name, model::Status status)
+		{
+			model::Step step(type);
+			step.setName(name);
+			step.setStatus(status);
+			step.setStage(model::Stage::FINISHED);
+			step.setStart(125000);
+			step.setStop(126000);
+			return step;
+		}
+
+	protected:
+		std::unique_ptr<service::TestSuiteJSONStreamSerializer> m_service;
+		std::unique_ptr<service::TestSuiteJSONSerializer> m_documentSerializer;
+	};
+
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeForTCWithoutActions)
+	{
+		model::TestSuite testSuite = buildTestSuite("Test suite name");
+
+		std::string expectedSerializedTestSuite =
+			"{\"uuid\":\"3E43CDC5-0839-4ABB-8ED2-BE669F89D512\",\"name\":\"Test suite name\",\"status\":\"failed\","
+			"\"stage\":\"finished\",\"start\":123456,\"stop\":789012,"
+			"\"labels\":[{\"name\":\"suite\",\"value\":\"Test suite name\"}]}";
+
+		ASSERT_EQ(expectedSerializedTestSuite, m_service->serialize(testSuite));
+	}
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeForTCWithLinksAndLabelsGivesSameJSONAsDocumentSerializer)
+	{
+		model::TestSuite testSuite = buildTestSuite("Test suite with links and labels");
+		addLinksAndLabels(testSuite);
+
+		ASSERT_EQ(m_documentSerializer->serialize(testSuite), m_service->serialize(testSuite));
+	}
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeForTCWithActionsAndExpectedResultsGivesSameJSONAsDocumentSerializer)
+	{
+		model::TestSuite testSuite = buildTestSuite("Test suite with test cases");
+		addLinksAndLabels(testSuite);
+		addTestCases(testSuite);
+
+		ASSERT_EQ(m_documentSerializer->serialize(testSuite), m_service->serialize(testSuite));
+	}
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeForTCWithNestedStepsGivesSameJSONAsDocumentSerializer)
+	{
+		model::TestSuite testSuite = buildTestSuite("Test suite with nested steps");
+
+		model::TestCase testCase;
+		testCase.setName("Test case with nested steps");
+		model::Step outerStep = buildStep(model::StepType::ACTION_STEP, "Outer action", model::Status::PASSED);
+		outerStep.setNestedStepsCount(2);
+		testCase.addStep(outerStep);
+		model::Step innerStep = buildStep(model::StepType::ACTION_STEP, "Inner action", model::Status::PASSED);
+		innerStep.setNestedStepsCount(1);
+		testCase.addStep(innerStep);
+		testCase.addStep(buildStep(model::StepType::EXPECTED_RESULT_STEP, "Innermost result", model::Status::FAILED));
+		testCase.addStep(buildStep(model::StepType::EXPECTED_RESULT_STEP, "Sibling result", model::Status::PASSED));
+		testSuite.addTestCase(testCase);
+
+		ASSERT_EQ(m_documentSerializer->serialize(testSuite), m_service->serialize(testSuite));
+	}
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeForJenkinsFormatGivesSameJSONAsDocumentSerializer)
+	{
+		model::TestSuite testSuite = buildTestSuite("Test suite for Jenkins");
+		testSuite.setFormat(model::Format::ALLURE_FOR_JENKINS);
+		addTestCases(testSuite);
+
+		std::string serializedTestSuite = m_service->serialize(testSuite);
+		ASSERT_EQ(std::string::npos, serializedTestSuite.find("\"uuid\""));
+		ASSERT_EQ(m_documentSerializer->serialize(testSuite), serializedTestSuite);
+	}
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeEscapesSpecialCharactersAsDocumentSerializer)
+	{
+		model::TestSuite testSuite = buildTestSuite("Suite with \"quotes\", back\\slash and\nnew line");
+		addTestCases(testSuite);
+
+		ASSERT_EQ(m_documentSerializer->serialize(testSuite), m_service->serialize(testSuite));
+	}
+
+	TEST_F(TestSuiteJSONStreamSerializerTest, testSerializeIntoBufferReplacesPreviousContents)
+	{
+		model::TestSuite testSuite = buildTestSuite("Test suite name");
+		addTestCases(testSuite);
+
+		std::string output = "previous contents";
+		m_service->serialize(testSuite, output);
+
+		ASSERT_EQ(m_documentSerializer->serialize(testSuite), output);
+	}
+
+}}}
@@ -0,0 +1,48 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/ServicesFactory.h"
+
+#include "GTestAllureUtilities/Services/EventHandlers/ITestStepEndEventHandler.h"
+#include "GTestAllureUtilities/Services/EventHandlers/ITestStepStartEventHandler.h"
+#include "GTestAllureUtilities/Services/GoogleTest/IGTestStatusChecker.h"
+
+#include "Model/TestProgram.h"
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class ServicesFactoryTest : public Test
+	{
+	public:
+		void SetUp()
+		{
+			m_factory = std::make_unique<service::ServicesFactory>(m_testProgram);
+		}
+
+	protected:
+		model::TestProgram m_testProgram;
+		std::unique_ptr<service::ServicesFactory> m_factory;
+	};
+
+
+	TEST_F(ServicesFactoryTest, testGetTestStepHandlersReturnsSameInstanceOnEveryCall)
+	{
+		ASSERT_EQ(&m_factory->getTestStepStartEventHandler(), &m_factory->getTestStepStartEventHandler());
+		ASSERT_EQ(&m_factory->getTestStepEndEventHandler(), &m_factory->getTestStepEndEventHandler());
+		ASSERT_EQ(&m_factory->getGTestStatusChecker(), &m_factory->getGTestStatusChecker());
+	}
+
+	TEST_F(ServicesFactoryTest, testGetTestStepHandlersFollowsClockTypeOfTestProgram)
+	{
+		m_testProgram.setClockType(model::ClockType::PRECISE);
+		const service::ITestStepStartEventHandler* preciseHandler = &m_factory->getTestStepStartEventHandler();
+
+		m_testProgram.setClockType(model::ClockType::COARSE);
+		const service::ITestStepStartEventHandler* coarseHandler = &m_factory->getTestStepStartEventHandler();
+
+		ASSERT_NE(preciseHandler, coarseHandler);
+	}
+
+}}}
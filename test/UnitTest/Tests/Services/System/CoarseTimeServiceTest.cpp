@@ -0,0 +1,58 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/System/CoarseTimeService.h"
+
+#include <chrono>
+#include <thread>
+
+
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class CoarseTimeServiceTest : public testing::Test
+	{
+	protected:
+		service::CoarseTimeService m_service;
+	};
+
+
+	TEST_F(CoarseTimeServiceTest, testGetCurrentTimeMsReturnsMillisecondsSinceEpochCloseToSystemClock)
+	{
+		int64_t systemTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+		int64_t currentTimeMs = m_service.getCurrentTimeMs();
+
+		ASSERT_NEAR(systemTimeMs, currentTimeMs, 1000);
+	}
+
+	TEST_F(CoarseTimeServiceTest, testGetCurrentTimeMsNeverDecreasesOnConsecutiveCalls)
+	{
+		int64_t previousTimeMs = m_service.getCurrentTimeMs();
+		for (unsigned int i = 0; i < 10000; i++)
+		{
+			int64_t currentTimeMs = m_service.getCurrentTimeMs();
+			ASSERT_GE(currentTimeMs, previousTimeMs);
+			previousTimeMs = currentTimeMs;
+		}
+	}
+
+	TEST_F(CoarseTimeServiceTest, testGetCurrentTimeMsAdvancesAfterWaiting50Milliseconds)
+	{
+		int64_t currentTimeMs1 = m_service.getCurrentTimeMs();
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		int64_t currentTimeMs2 = m_service.getCurrentTimeMs();
+
+		// Tolerates one kernel tick of resolution on each reading
+		ASSERT_GE(currentTimeMs2, currentTimeMs1 + 40);
+	}
+
+	TEST_F(CoarseTimeServiceTest, testGetCurrentTimeReturnsSecondsConsistentWithGetCurrentTimeMs)
+	{
+		int64_t currentTimeMs = m_service.getCurrentTimeMs();
+		time_t currentTime = m_service.getCurrentTime();
+
+		ASSERT_GE(currentTime, currentTimeMs / 1000);
+		ASSERT_LE(currentTime, (currentTimeMs / 1000) + 1);
+	}
+
+}}}
@@ -0,0 +1,93 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/System/ContentHasher.h"
+
+#include <unordered_set>
+
+
+using namespace testing;
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class ContentHasherTest : public Test
+	{
+	protected:
+		std::string buildContent(size_t size)
+		{
+			std::string content(size, '\0');
+			for (size_t i = 0; i < size; i++)
+			{
+				content[i] = static_cast<char>((i * 31 + 7) & 0xFF);
+			}
+
+			return content;
+		}
+	};
+
+
+	TEST_F(ContentHasherTest, testHashIsSameForSameContent)
+	{
+		std::string content = buildContent(1000);
+		std::string contentCopy = content;
+
+		ASSERT_EQ(service::ContentHasher::hash(content), service::ContentHasher::hash(contentCopy));
+	}
+
+	TEST_F(ContentHasherTest, testHashToHexGivesLowercaseHexDigitsOfHash)
+	{
+		service::ContentHasher::Hash hash = { 0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL };
+
+		ASSERT_EQ("0123456789abcdeffedcba9876543210", service::ContentHasher::toHex(hash));
+	}
+
+	TEST_F(ContentHasherTest, testHashToHexGivesHexOfHash)
+	{
+		std::string content = buildContent(100);
+
+		std::string hex = service::ContentHasher::hashToHex(content);
+
+		ASSERT_EQ(service::ContentHasher::HASH_LENGTH, hex.size());
+		ASSERT_EQ(service::ContentHasher::toHex(service::ContentHasher::hash(content)), hex);
+	}
+
+	TEST_F(ContentHasherTest, testHashChangesWhenSingleBitOfContentChanges)
+	{
+		std::string content = buildContent(100);
+		auto hash = service::ContentHasher::hash(content);
+
+		for (size_t bit = 0; bit < 8 * content.size(); bit++)
+		{
+			std::string changedContent = content;
+			changedContent[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+			ASSERT_NE(hash, service::ContentHasher::hash(changedContent)) << "Bit " << bit;
+		}
+	}
+
+	TEST_F(ContentHasherTest, testHashChangesWhenTrailingZeroBytesAreAdded)
+	{
+		std::unordered_set<std::string> hashes;
+		for (size_t size = 0; size <= 48; size++)
+		{
+			ASSERT_TRUE(hashes.insert(service::ContentHasher::hashToHex(std::string(size, '\0'))).second) << "Size " << size;
+		}
+	}
+
+	TEST_F(ContentHasherTest, testHashChangesWhenBlocksAreSwapped)
+	{
+		std::string firstBlock(16, 'a');
+		std::string secondBlock(16, 'b');
+
+		ASSERT_NE(service::ContentHasher::hash(firstBlock + secondBlock), service::ContentHasher::hash(secondBlock + firstBlock));
+	}
+
+	TEST_F(ContentHasherTest, testHashHasNoCollisionsForManySimilarContents)
+	{
+		std::unordered_set<std::string> hashes;
+		for (unsigned int i = 0; i < 100000; i++)
+		{
+			std::string content = "Test case " + std::to_string(i) + " log";
+			ASSERT_TRUE(hashes.insert(service::ContentHasher::hashToHex(content)).second) << content;
+		}
+	}
+
+}}}
@@ -0,0 +1,120 @@
+#include "stdafx.h"
+#include "GTestAllureUtilities/Services/System/OutputFolder.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+
+using namespace systelab::gtest_allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class OutputFolderTest : public testing::Test
+	{
+		void SetUp()
+		{
+			m_testFolder = "OutputFolderTest";
+			std::filesystem::remove_all(m_testFolder);
+		}
+
+		void TearDown()
+		{
+			m_service.close();
+			std::filesystem::remove_all(m_testFolder);
+		}
+
+	protected:
+		std::string readFile(const std::string& folderPath, const std::string& fileName)
+		{
+			std::ifstream fileStream(std::filesystem::path(folderPath) / fileName, std::ios::binary);
+			std::stringstream buffer;
+			buffer << fileStream.rdbuf();
+			return buffer.str();
+		}
+
+	protected:
+		service::OutputFolder m_service;
+		std::string m_testFolder;
+	};
+
+
+	TEST_F(OutputFolderTest, testOpenCreatesMissingFolders)
+	{
+		std::string folderPath = m_testFolder + "/Nested/Results";
+		m_service.open(folderPath);
+
+		ASSERT_TRUE(std::filesystem::is_directory(folderPath));
+		ASSERT_TRUE(m_service.isOpen());
+		ASSERT_EQ(folderPath, m_service.getPath());
+	}
+
+	TEST_F(OutputFolderTest, testCloseResetsFolder)
+	{
+		m_service.open(m_testFolder);
+		m_service.close();
+
+		ASSERT_FALSE(m_service.isOpen());
+		ASSERT_EQ("", m_service.getPath());
+	}
+
+	TEST_F(OutputFolderTest, testSaveFileWritesGivenContentIntoFolder)
+	{
+		m_service.open(m_testFolder);
+
+		std::string content = "This is the test content to write";
+		m_service.saveFile("result.json", content.data(), content.size());
+
+		ASSERT_EQ(content, readFile(m_testFolder, "result.json"));
+	}
+
+	TEST_F(OutputFolderTest, testSaveFileReplacesContentOfExistingFile)
+	{
+		m_service.open(m_testFolder);
+
+		m_service.saveFile("result.json", "Previous content", 16);
+		m_service.saveFile("result.json", "New", 3);
+
+		ASSERT_EQ("New", readFile(m_testFolder, "result.json"));
+	}
+
+	TEST_F(OutputFolderTest, testAppendFileAddsContentAfterExistingContent)
+	{
+		m_service.open(m_testFolder);
+
+		m_service.appendFile("log.txt", "First;", 6);
+		m_service.appendFile("log.txt", "Second;", 7);
+
+		ASSERT_EQ("First;Second;", readFile(m_testFolder, "log.txt"));
+	}
+
+	TEST_F(OutputFolderTest, testOpenAnotherFolderSavesNextFilesIntoIt)
+	{
+		m_service.open(m_testFolder + "/First");
+		m_service.saveFile("first.json", "1", 1);
+		m_service.open(m_testFolder + "/Second");
+		m_service.saveFile("second.json", "2", 1);
+
+		ASSERT_EQ("1", readFile(m_testFolder + "/First", "first.json"));
+		ASSERT_EQ("2", readFile(m_testFolder + "/Second", "second.json"));
+		ASSERT_FALSE(std::filesystem::exists(std::filesystem::path(m_testFolder) / "Second" / "first.json"));
+	}
+
+	TEST_F(OutputFolderTest, testOpenThrowsExceptionWhenFolderCannotBeCreated)
+	{
+		std::filesystem::create_directories(m_testFolder);
+		std::string regularFilePath = m_testFolder + "/RegularFile.txt";
+		std::ofstream(regularFilePath) << "Regular file";
+
+		ASSERT_THROW(m_service.open(regularFilePath + "/Subfolder"), service::OutputFolder::UnableToOpenFolderException);
+		ASSERT_FALSE(m_service.isOpen());
+	}
+
+#if !defined(_WIN32)
+	TEST_F(OutputFolderTest, testSaveFileThrowsExceptionWhenFolderNotOpen)
+	{
+		ASSERT_THROW(m_service.saveFile("result.json", "{}", 2), service::OutputFolder::UnableToWriteFileException);
+	}
+#endif
+
+}}}
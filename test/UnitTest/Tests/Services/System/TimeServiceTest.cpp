@@ -32,4 +32,42 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_GE(currentTime2, currentTime1+2);
 	}
 
+	TEST_F(TimeServiceTest, testGetCurrentTimeMsReturnsMillisecondsSinceEpochCloseToSystemClock)
+	{
+		int64_t systemTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+		int64_t currentTimeMs = m_service.getCurrentTimeMs();
+
+		ASSERT_NEAR(systemTimeMs, currentTimeMs, 1000);
+	}
+
+	TEST_F(TimeServiceTest, testGetCurrentTimeMsReturnsTime50MillisecondsGreaterAfterWaiting50Milliseconds)
+	{
+		int64_t currentTimeMs1 = m_service.getCurrentTimeMs();
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		int64_t currentTimeMs2 = m_service.getCurrentTimeMs();
+
+		ASSERT_GE(currentTimeMs2, currentTimeMs1 + 50);
+	}
+
+	TEST_F(TimeServiceTest, testGetCurrentTimeNsNeverDecreasesOnConsecutiveCalls)
+	{
+		int64_t previousTimeNs = m_service.getCurrentTimeNs();
+		for (unsigned int i = 0; i < 10000; i++)
+		{
+			int64_t currentTimeNs = m_service.getCurrentTimeNs();
+			ASSERT_GE(currentTimeNs, previousTimeNs);
+			previousTimeNs = currentTimeNs;
+		}
+	}
+
+	TEST_F(TimeServiceTest, testGetCurrentTimeNsIsConsistentWithGetCurrentTimeMs)
+	{
+		int64_t currentTimeMs = m_service.getCurrentTimeMs();
+		int64_t currentTimeNs = m_service.getCurrentTimeNs();
+
+		ASSERT_GE(currentTimeNs / 1000000, currentTimeMs);
+		ASSERT_LT(currentTimeNs / 1000000, currentTimeMs + 1000);
+	}
+
 }}}
@@ -1,6 +1,10 @@
 #include "stdafx.h"
 #include "GTestAllureUtilities/Services/System/UUIDGeneratorService.h"
 
+#include <chrono>
+#include <set>
+#include <thread>
+
 
 using namespace systelab::gtest_allure;
 
@@ -100,4 +104,54 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		EXPECT_TRUE(isHexChar(generatedUUID[35]));
 	}
 
+	TEST_F(UUIDGeneratorServiceTest, testGenerateUUIDReturnsVersion4WithRFCVariantByDefault)
+	{
+		std::string generatedUUID = m_service.generateUUID();
+		ASSERT_EQ(36, generatedUUID.size());
+		EXPECT_EQ('4', generatedUUID[14]);
+		EXPECT_TRUE((generatedUUID[19] == '8') || (generatedUUID[19] == '9') ||
+					(generatedUUID[19] == 'a') || (generatedUUID[19] == 'b'));
+	}
+
+	TEST_F(UUIDGeneratorServiceTest, testGenerateUUIDReturnsDifferentValuesOnConsecutiveCalls)
+	{
+		std::set<std::string> generatedUUIDs;
+		for (unsigned int i = 0; i < 1000; i++)
+		{
+			generatedUUIDs.insert(m_service.generateUUID());
+		}
+
+		ASSERT_EQ(1000, generatedUUIDs.size());
+	}
+
+	TEST_F(UUIDGeneratorServiceTest, testGenerateUUIDReturnsVersion7WhenConfiguredForTimeOrderedUUIDs)
+	{
+		service::UUIDGeneratorService service(model::UUIDVersion::V7);
+		std::string generatedUUID = service.generateUUID();
+		ASSERT_EQ(36, generatedUUID.size());
+		EXPECT_EQ('7', generatedUUID[14]);
+	}
+
+	TEST_F(UUIDGeneratorServiceTest, testGenerateUUIDReturnsVersion7UUIDsOrderedByGenerationTime)
+	{
+		service::UUIDGeneratorService service(model::UUIDVersion::V7);
+		std::string firstUUID = service.generateUUID();
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		std::string secondUUID = service.generateUUID();
+
+		ASSERT_LT(firstUUID, secondUUID);
+	}
+
+	TEST_F(UUIDGeneratorServiceTest, testGenerateUUIDReturnsStrictlyIncreasingVersion7UUIDsWithinSameMillisecond)
+	{
+		service::UUIDGeneratorService service(model::UUIDVersion::V7);
+		std::string previousUUID = service.generateUUID();
+		for (unsigned int i = 0; i < 10000; i++)
+		{
+			std::string generatedUUID = service.generateUUID();
+			ASSERT_LT(previousUUID, generatedUUID);
+			previousUUID = generatedUUID;
+		}
+	}
+
 }}}